@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+#include <typeindex>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/component/Transform.h"
+
+using namespace GLaDOS;
+
+template <int N>
+class Probe : public Component {
+  public:
+    Probe() : Component("Probe") {}
+
+  protected:
+    Component* clone() override { return nullptr; }
+    void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+    void update([[maybe_unused]] real deltaTime) override {}
+    void render() override {}
+};
+
+static void BM_GetComponentByTypeId(benchmark::State& state) {
+    GameObject gameObject{"probe", nullptr};
+    gameObject.addComponent<Probe<0>>();
+    gameObject.addComponent<Probe<1>>();
+    gameObject.addComponent<Probe<2>>();
+    gameObject.addComponent<Probe<3>>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(gameObject.getComponent<Transform>());
+        benchmark::DoNotOptimize(gameObject.getComponent<Probe<2>>());
+        benchmark::DoNotOptimize(gameObject.getComponent<Probe<7>>());  // miss
+    }
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+
+// the former lookup, a type_index keyed hash map per game object
+static void BM_GetComponentByTypeIndex(benchmark::State& state) {
+    GameObject gameObject{"probe", nullptr};
+    UnorderedMap<std::type_index, Component*> components;
+    components.try_emplace(std::type_index(typeid(Transform)), gameObject.transform());
+    components.try_emplace(std::type_index(typeid(Probe<0>)), gameObject.addComponent<Probe<0>>());
+    components.try_emplace(std::type_index(typeid(Probe<1>)), gameObject.addComponent<Probe<1>>());
+    components.try_emplace(std::type_index(typeid(Probe<2>)), gameObject.addComponent<Probe<2>>());
+    components.try_emplace(std::type_index(typeid(Probe<3>)), gameObject.addComponent<Probe<3>>());
+    auto lookup = [&components](std::type_index type) -> Component* {
+        auto iter = components.find(type);
+        return iter == components.end() ? nullptr : iter->second;
+    };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lookup(std::type_index(typeid(Transform))));
+        benchmark::DoNotOptimize(lookup(std::type_index(typeid(Probe<2>))));
+        benchmark::DoNotOptimize(lookup(std::type_index(typeid(Probe<7>))));
+    }
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+
+BENCHMARK(BM_GetComponentByTypeId);
+BENCHMARK(BM_GetComponentByTypeIndex);
+
+// 10000 objects of which 1% carry the component looked for
+static Scene* makeSparseScene(std::size_t count) {
+    Scene* scene = NEW_T(Scene);
+    for (std::size_t i = 0; i < count; i++) {
+        GameObject* gameObject = scene->createGameObject("probe");
+        if (i % 100 == 0) {
+            gameObject->addComponent<Probe<4>>();
+        }
+    }
+    return scene;
+}
+
+static void BM_FindObjectsOfTypeByWalk(benchmark::State& state) {
+    Scene* scene = makeSparseScene(10000);
+    Vector<GameObject*> gameObjects;
+    scene->forEachInLayer(0, [&gameObjects](GameObject* gameObject) { gameObjects.push_back(gameObject); });
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (GameObject* gameObject : gameObjects) {
+            found += gameObject->getComponent<Probe<4>>() != nullptr ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    DELETE_T(scene, Scene);
+}
+
+static void BM_FindObjectsOfTypeByRegistry(benchmark::State& state) {
+    Scene* scene = makeSparseScene(10000);
+    for (auto _ : state) {
+        std::size_t found = 0;
+        scene->forEachObjectOfType<Probe<4>>([&found](Probe<4>* probe) { found += probe != nullptr ? 1 : 0; });
+        benchmark::DoNotOptimize(found);
+    }
+    DELETE_T(scene, Scene);
+}
+
+BENCHMARK(BM_FindObjectsOfTypeByWalk);
+BENCHMARK(BM_FindObjectsOfTypeByRegistry);
@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+#include "memory/FrameArena.h"
+
+using namespace GLaDOS;
+
+// Simulates one frame worth of short lived vectors (e.g. copied child lists) per iteration.
+static constexpr int temporariesPerFrame = 256;
+static constexpr int elementsPerTemporary = 16;
+
+static void BM_TemporaryVectorPerFrame(benchmark::State& state) {
+    for (auto _ : state) {
+        for (int i = 0; i < temporariesPerFrame; i++) {
+            Vector<void*> temporary(elementsPerTemporary);
+            benchmark::DoNotOptimize(temporary.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * temporariesPerFrame);
+}
+
+BENCHMARK(BM_TemporaryVectorPerFrame);
+
+static void BM_FrameArenaVectorPerFrame(benchmark::State& state) {
+    FrameArena arena;
+    for (auto _ : state) {
+        for (int i = 0; i < temporariesPerFrame; i++) {
+            FrameVector<void*> temporary(elementsPerTemporary, nullptr, FrameAllocator<void*>{arena});
+            benchmark::DoNotOptimize(temporary.data());
+        }
+        arena.swapBuffers();
+    }
+    state.SetItemsProcessed(state.iterations() * temporariesPerFrame);
+}
+
+BENCHMARK(BM_FrameArenaVectorPerFrame);
@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/component/Transform.h"
+#include "core/component/renderer/MeshRenderer.h"
+#include "platform/Platform.h"
+#include "platform/render/Material.h"
+#include "platform/render/Renderer.h"
+#include "utils/MeshGenerator.h"
+
+using namespace GLaDOS;
+
+class Health : public Component {
+  public:
+    Health() : Component("Health") {}
+
+  protected:
+    Component* clone() override {
+        Health* health = newComponent<Health>();
+        health->mValue = mValue;
+        return health;
+    }
+    void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+    void update([[maybe_unused]] real deltaTime) override {}
+    void render() override {}
+
+  private:
+    real mValue{100};
+};
+
+// an enemy made of a body and two attachments. clones share the mesh and the material of the body,
+// so bytes_per_clone only grows by the renderable of each clone
+static GameObject* makePrefab(Scene* scene) {
+    static bool initialized = Platform::getInstance().initializeHeadless(800, 600);
+    benchmark::DoNotOptimize(initialized);
+    Renderer& renderer = Platform::getRenderer();
+    Material* material = NEW_T(Material(renderer.createShaderProgramFromFile("vertex", "fragment", nullptr)));
+
+    GameObject* prefab = scene->createGameObject("enemy");
+    prefab->addComponent<Health>();
+    prefab->addComponent<MeshRenderer>(MeshGenerator::generateCube(), material);
+    scene->createGameObject("weapon", prefab);
+    scene->createGameObject("shield", prefab);
+    return prefab;
+}
+
+static void reportMemory(benchmark::State& state, std::size_t liveBytes, std::size_t clones) {
+    state.counters["bytes_per_clone"] = benchmark::Counter(static_cast<double>(liveBytes) / static_cast<double>(clones));
+}
+
+static Vector<Mat4<real>> makeTransforms(std::size_t count) {
+    Vector<Mat4<real>> transforms;
+    for (std::size_t i = 0; i < count; i++) {
+        transforms.push_back(Mat4<real>::translate(Vec3{static_cast<real>(i), 0, 0}));
+    }
+    return transforms;
+}
+
+static void BM_InstantiateOneByOne(benchmark::State& state) {
+    std::size_t count = static_cast<std::size_t>(state.range(0));
+    Vector<Mat4<real>> transforms = makeTransforms(count);
+    std::size_t liveBytes = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Scene* scene = NEW_T(Scene);
+        GameObject* prefab = makePrefab(scene);
+        std::size_t before = memoryTagUsage(MemoryTag::Scene).liveBytes;
+        state.ResumeTiming();
+        {
+            ScopedMemoryTag tag{MemoryTag::Scene};
+            for (std::size_t i = 0; i < count; i++) {
+                GameObject* clone = scene->instantiate(prefab);
+                clone->transform()->decomposeSRT(transforms[i]);
+            }
+        }
+        state.PauseTiming();
+        liveBytes = memoryTagUsage(MemoryTag::Scene).liveBytes - before;
+        DELETE_T(scene, Scene);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    reportMemory(state, liveBytes, count);
+}
+
+BENCHMARK(BM_InstantiateOneByOne)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_InstantiateMany(benchmark::State& state) {
+    std::size_t count = static_cast<std::size_t>(state.range(0));
+    Vector<Mat4<real>> transforms = makeTransforms(count);
+    std::size_t liveBytes = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Scene* scene = NEW_T(Scene);
+        GameObject* prefab = makePrefab(scene);
+        std::size_t before = memoryTagUsage(MemoryTag::Scene).liveBytes;
+        state.ResumeTiming();
+        {
+            ScopedMemoryTag tag{MemoryTag::Scene};
+            benchmark::DoNotOptimize(scene->instantiateMany(prefab, count, transforms.data()));
+        }
+        state.PauseTiming();
+        liveBytes = memoryTagUsage(MemoryTag::Scene).liveBytes - before;
+        DELETE_T(scene, Scene);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    reportMemory(state, liveBytes, count);
+}
+
+BENCHMARK(BM_InstantiateMany)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include "math/Mat4.hpp"
+
+using namespace GLaDOS;
+
+// the scalar triple loop Mat4<T>::operator*= runs for other types
+static Mat4<real> multiplyScalar(const Mat4<real>& a, const Mat4<real>& b) {
+    Mat4<real> t;
+    for (unsigned r = 0; r < 4; r++) {
+        for (unsigned c = 0; c < 4; c++) {
+            t._m44[r][c] = 0.0;
+            for (unsigned k = 0; k < 4; k++) {
+                t._m44[r][c] += a._m44[r][k] * b._m44[k][c];
+            }
+        }
+    }
+    return t;
+}
+
+// the cofactor expansion Mat4<T>::inverse runs for other types
+static Mat4<real> inverseByAdjugate(const Mat4<real>& m) {
+    return Mat4<real>::adjugate(m) * (real(1) / Mat4<real>::determinant(m));
+}
+
+static Mat4<real> makeModelView() {
+    Mat4<real> model = Mat4<real>::buildSRT(Vec3{1, -2, 3}, Quat::fromEuler(Vec3{0.3f, 0.5f, -0.2f}), Vec3{2, 1, 0.5f});
+    return model * Mat4<real>::lookAt(Vec3{0, 2, -10}, Vec3{0, 0, 0}, UVec3::up);
+}
+
+static void BM_Mat4MultiplyScalar(benchmark::State& state) {
+    Mat4<real> a = makeModelView();
+    Mat4<real> b = Mat4<real>::perspective(Rad{1.f}, 1.7f, 0.1f, 100.f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(multiplyScalar(a, b));
+    }
+}
+
+static void BM_Mat4Multiply(benchmark::State& state) {
+    Mat4<real> a = makeModelView();
+    Mat4<real> b = Mat4<real>::perspective(Rad{1.f}, 1.7f, 0.1f, 100.f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(a * b);
+    }
+}
+
+static void BM_Mat4InverseByAdjugate(benchmark::State& state) {
+    Mat4<real> m = makeModelView();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(inverseByAdjugate(m));
+    }
+}
+
+static void BM_Mat4Inverse(benchmark::State& state) {
+    Mat4<real> m = makeModelView();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(Mat4<real>::inverse(m));
+    }
+}
+
+static void BM_Mat4InverseAffine(benchmark::State& state) {
+    Mat4<real> m = makeModelView();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(Mat4<real>::inverseAffine(m));
+    }
+}
+
+static void BM_Mat4Transpose(benchmark::State& state) {
+    Mat4<real> m = makeModelView();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(Mat4<real>::transpose(m));
+    }
+}
+
+BENCHMARK(BM_Mat4MultiplyScalar);
+BENCHMARK(BM_Mat4Multiply);
+BENCHMARK(BM_Mat4InverseByAdjugate);
+BENCHMARK(BM_Mat4Inverse);
+BENCHMARK(BM_Mat4InverseAffine);
+BENCHMARK(BM_Mat4Transpose);
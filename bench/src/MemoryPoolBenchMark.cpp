@@ -1,5 +1,8 @@
 #include <benchmark/benchmark.h>
+#include <atomic>
+#include <thread>
 #include "memory/FixedSizeMemoryPool.hpp"
+#include "memory/ThreadLocalAllocator.hpp"
 
 using namespace GLaDOS;
 
@@ -26,6 +29,20 @@ static void BM_FixedSizeMemoryPoolAllocation(benchmark::State& state) {
 
 BENCHMARK(BM_FixedSizeMemoryPoolAllocation);
 
+static void BM_FixedSizeMemoryPoolGrowth(benchmark::State& state) {
+    Vector<MockKlass*> objects(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        FixedSizeMemoryPool<MockKlass> mockPool;
+        for (auto& object : objects) {
+            object = mockPool.allocate(10);
+        }
+        benchmark::DoNotOptimize(objects.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_FixedSizeMemoryPoolGrowth)->Arg(16)->Arg(1 << 10)->Arg(1 << 16);
+
 static void BM_WithoutMemoryPoolAllocation(benchmark::State& state) {
     for (auto _ : state) {
         MockKlass* t = new MockKlass(10);
@@ -33,4 +50,56 @@ static void BM_WithoutMemoryPoolAllocation(benchmark::State& state) {
     }
 }
 
-BENCHMARK(BM_WithoutMemoryPoolAllocation);
\ No newline at end of file
+BENCHMARK(BM_WithoutMemoryPoolAllocation);
+
+static constexpr std::size_t crossThreadBatchSize = 1024;
+
+// Objects are allocated on the benchmark thread and freed on a consumer thread in batches.
+template <typename AllocateFn, typename DeallocateFn>
+static void runCrossThreadFree(benchmark::State& state, AllocateFn allocateFn, DeallocateFn deallocateFn) {
+    Vector<MockKlass*> batch(crossThreadBatchSize);
+    std::atomic<int> phase{0};  // 0: producer fills, 1: consumer frees, 2: stop
+    std::thread consumer([&batch, &phase, &deallocateFn] {
+        for (;;) {
+            int current;
+            while ((current = phase.load(std::memory_order_acquire)) == 0) {
+                std::this_thread::yield();
+            }
+            if (current == 2) {
+                return;
+            }
+            for (auto& object : batch) {
+                deallocateFn(object);
+            }
+            phase.store(0, std::memory_order_release);
+        }
+    });
+
+    for (auto _ : state) {
+        for (auto& object : batch) {
+            object = allocateFn();
+        }
+        phase.store(1, std::memory_order_release);
+        while (phase.load(std::memory_order_acquire) == 1) {
+            std::this_thread::yield();
+        }
+    }
+    phase.store(2, std::memory_order_release);
+    consumer.join();
+    state.SetItemsProcessed(state.iterations() * crossThreadBatchSize);
+}
+
+static void BM_ThreadLocalAllocatorCrossThreadFree(benchmark::State& state) {
+    ThreadLocalAllocator<MockKlass> allocator;
+    runCrossThreadFree(
+        state, [&allocator] { return allocator.allocate(10); }, [&allocator](MockKlass* object) { allocator.deallocate(object); });
+}
+
+BENCHMARK(BM_ThreadLocalAllocatorCrossThreadFree)->UseRealTime();
+
+static void BM_WithoutMemoryPoolCrossThreadFree(benchmark::State& state) {
+    runCrossThreadFree(
+        state, [] { return new MockKlass(10); }, [](MockKlass* object) { delete object; });
+}
+
+BENCHMARK(BM_WithoutMemoryPoolCrossThreadFree)->UseRealTime();
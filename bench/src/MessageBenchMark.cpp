@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+#include "core/GameObject.hpp"
+#include "core/MessageBus.hpp"
+
+using namespace GLaDOS;
+
+struct CollisionPayload {
+    real point[3];
+    real normal[3];
+    real impulse;
+    uint32_t otherId;
+};
+
+class CollisionReceiver : public Component {
+  public:
+    CollisionReceiver() : Component("CollisionReceiver") {}
+
+    real mImpulse{0};
+
+  protected:
+    MessageResult handleMessage(Message& msg) override {
+        BlobReader reader{msg.view()};
+        mImpulse += reader.read<CollisionPayload>().impulse;
+        return MessageResult::Ignored;
+    }
+    Component* clone() override { return nullptr; }
+    void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+    void update([[maybe_unused]] real deltaTime) override {}
+    void render() override {}
+};
+
+static GameObject* makeHierarchy(std::size_t childCount) {
+    GameObject* root = NEW_T(GameObject("root", nullptr));
+    for (std::size_t i = 0; i < childCount; i++) {
+        GameObject* child = NEW_T(GameObject("child", root, nullptr));
+        child->addComponent<CollisionReceiver>();
+        child->subscribeToMessageType<CollisionReceiver>(MessageType::OnCollisionEnter);
+    }
+    return root;
+}
+
+static void destroyHierarchy(GameObject* root) {
+    for (GameObject* child : root->getChildren()) {
+        DELETE_T(child, GameObject);
+    }
+    DELETE_T(root, GameObject);
+}
+
+static void BM_BroadcastMessage(benchmark::State& state) {
+    GameObject* root = makeHierarchy(static_cast<std::size_t>(state.range(0)));
+    CollisionPayload payload{{0, 1, 0}, {0, 1, 0}, 1, 42};
+    for (auto _ : state) {
+        Message msg{MessageType::OnCollisionEnter, &payload, sizeof(payload)};
+        root->broadcastMessage(msg);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    destroyHierarchy(root);
+}
+
+BENCHMARK(BM_BroadcastMessage)->Arg(16)->Arg(256);
+
+// fan-out where every receiver keeps its own copy of the message (e.g. queued for later)
+static void BM_MessageDeepCopyPerReceiver(benchmark::State& state) {
+    Blob payload;
+    payload.resize(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (int i = 0; i < 64; i++) {
+            Blob copy{payload};
+            benchmark::DoNotOptimize(copy.constPointer());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+
+BENCHMARK(BM_MessageDeepCopyPerReceiver)->Arg(64)->Arg(4096);
+
+static void BM_MessageSharedCopyPerReceiver(benchmark::State& state) {
+    Blob payload;
+    payload.resize(static_cast<std::size_t>(state.range(0)));
+    Message msg{MessageType::OnCollisionEnter, payload};
+    for (auto _ : state) {
+        for (int i = 0; i < 64; i++) {
+            Message copy{msg};
+            benchmark::DoNotOptimize(copy.view().data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+
+BENCHMARK(BM_MessageSharedCopyPerReceiver)->Arg(64)->Arg(4096);
+
+// collision events addressed to single receivers, one Message with its own payload per event
+static void BM_SendCollisionPerEvent(benchmark::State& state) {
+    GameObject* root = makeHierarchy(static_cast<std::size_t>(state.range(0)));
+    Vector<GameObject*> children = root->getChildren();
+    CollisionPayload payload{{0, 1, 0}, {0, 1, 0}, 1, 42};
+    for (auto _ : state) {
+        for (int event = 0; event < 4; event++) {
+            for (GameObject* child : children) {
+                Message msg{MessageType::OnCollisionStay, &payload, sizeof(payload)};
+                child->sendMessage<CollisionReceiver>(msg);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 4 * state.range(0));
+    destroyHierarchy(root);
+}
+
+BENCHMARK(BM_SendCollisionPerEvent)->Arg(256)->Arg(4096);
+
+static void BM_MessageBusCollisionBatch(benchmark::State& state) {
+    GameObject* root = makeHierarchy(static_cast<std::size_t>(state.range(0)));
+    for (GameObject* child : root->getChildren()) {
+        child->subscribeToMessageType<CollisionReceiver>(MessageType::OnCollisionStay);
+    }
+    Vector<GameObject*> children = root->getChildren();
+    CollisionPayload payload{{0, 1, 0}, {0, 1, 0}, 1, 42};
+    MessageBus bus;
+    for (auto _ : state) {
+        for (int event = 0; event < 4; event++) {
+            for (GameObject* child : children) {
+                bus.post(child, MessageType::OnCollisionStay, payload);
+            }
+        }
+        bus.dispatch();
+    }
+    state.SetItemsProcessed(state.iterations() * 4 * state.range(0));
+    destroyHierarchy(root);
+}
+
+BENCHMARK(BM_MessageBusCollisionBatch)->Arg(256)->Arg(4096);
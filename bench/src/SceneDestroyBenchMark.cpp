@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+
+using namespace GLaDOS;
+
+// destroys every tenth object per frame and spawns as many again
+static void BM_SceneDestroyTenPercent(benchmark::State& state) {
+    Scene* scene = NEW_T(Scene);
+    std::size_t count = static_cast<std::size_t>(state.range(0));
+    Vector<GameObject*> objects;
+    objects.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        objects.push_back(scene->createGameObject("object"));
+    }
+
+    Vector<GameObject*> victims;
+    for (auto _ : state) {
+        state.PauseTiming();
+        victims.clear();
+        for (std::size_t i = 0; i < objects.size(); i += 10) {
+            victims.push_back(objects[i]);
+        }
+        state.ResumeTiming();
+
+        for (GameObject* victim : victims) {
+            scene->destroy(victim);
+        }
+        scene->flushDestroyQueue();
+
+        state.PauseTiming();
+        for (std::size_t i = 0; i < objects.size(); i += 10) {
+            objects[i] = scene->createGameObject("object");
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * (count / 10));
+    DELETE_T(scene, Scene);
+}
+
+BENCHMARK(BM_SceneDestroyTenPercent)->Arg(100000)->Unit(benchmark::kMillisecond);
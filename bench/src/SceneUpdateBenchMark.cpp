@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/component/Camera.h"
+#include "platform/Platform.h"
+#include "utils/FixedThreadPool.hpp"
+
+using namespace GLaDOS;
+
+class BenchScene : public Scene {
+  public:
+    using Scene::update;
+};
+
+// integrates a small particle system per object, touches only its own data
+class Integrator : public Component {
+  public:
+    Integrator() : Component("Integrator") {}
+    bool isThreadSafe() const override { return true; }
+
+  protected:
+    Component* clone() override { return nullptr; }
+    void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+    void update(real deltaTime) override {
+        for (int i = 0; i < 64; i++) {
+            mVelocity[i % 4] += -9.8f * deltaTime;
+            mPosition[i % 4] += mVelocity[i % 4] * deltaTime;
+        }
+    }
+    void render() override {}
+
+  private:
+    real mPosition[4]{};
+    real mVelocity[4]{};
+};
+
+static void runSceneUpdate(benchmark::State& state, FixedThreadPool* pool) {
+    BenchScene* scene = NEW_T(BenchScene);
+    scene->getMainCamera()->gameObject()->active(false);
+    for (int64_t i = 0; i < state.range(0); i++) {
+        scene->createGameObject("object")->addComponent<Integrator>();
+    }
+    scene->setUpdateThreadPool(pool);
+    for (auto _ : state) {
+        scene->update(0.016f);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    DELETE_T(scene, BenchScene);
+}
+
+static void BM_SceneUpdateSerial(benchmark::State& state) {
+    runSceneUpdate(state, nullptr);
+}
+
+static void BM_SceneUpdateParallel(benchmark::State& state) {
+    FixedThreadPool pool{static_cast<uint32_t>(std::max<std::size_t>(Platform::getConcurrency(), 2) - 1)};
+    runSceneUpdate(state, &pool);
+}
+
+BENCHMARK(BM_SceneUpdateSerial)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SceneUpdateParallel)->Arg(10000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// one object in a hundred is awake, the update cost should follow the awake ones.
+// the second argument runs the update through the ComponentStore, which only visits the awake rows
+static void BM_SceneUpdateMostlySleeping(benchmark::State& state) {
+    BenchScene* scene = NEW_T(BenchScene);
+    scene->getMainCamera()->gameObject()->active(false);
+    if (state.range(1) != 0) {
+        scene->enableComponentStore();
+    }
+    for (int64_t i = 0; i < state.range(0); i++) {
+        Integrator* integrator = scene->createGameObject("object")->addComponent<Integrator>();
+        if (i % 100 != 0) {
+            integrator->sleep();
+        }
+    }
+    for (auto _ : state) {
+        scene->update(0.016f);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["awake"] = static_cast<double>(scene->awakeObjectCount());
+    DELETE_T(scene, BenchScene);
+}
+
+BENCHMARK(BM_SceneUpdateMostlySleeping)->Args({10000, 0})->Args({10000, 1})->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include "memory/SizeClassAllocator.h"
+#include "utils/Stl.h"
+
+using namespace GLaDOS;
+
+static void BM_MallocNodeSizedBlock(benchmark::State& state) {
+    for (auto _ : state) {
+        void* block = MALLOC(32);
+        benchmark::DoNotOptimize(block);
+        FREE(block);
+    }
+}
+
+BENCHMARK(BM_MallocNodeSizedBlock);
+
+static void BM_SizeClassNodeSizedBlock(benchmark::State& state) {
+    for (auto _ : state) {
+        void* block = SizeClassAllocator::allocate(32);
+        benchmark::DoNotOptimize(block);
+        SizeClassAllocator::deallocate(block, 32);
+    }
+}
+
+BENCHMARK(BM_SizeClassNodeSizedBlock);
+
+static void BM_StdSetInsert(benchmark::State& state) {
+    for (auto _ : state) {
+        std::set<int> set;
+        for (int i = 0; i < state.range(0); i++) {
+            set.insert(i);
+        }
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_StdSetInsert)->Arg(1 << 10);
+
+static void BM_SetInsert(benchmark::State& state) {
+    for (auto _ : state) {
+        Set<int> set;
+        for (int i = 0; i < state.range(0); i++) {
+            set.insert(i);
+        }
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SetInsert)->Arg(1 << 10);
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/component/Transform.h"
+#include "core/spatial/LooseOctree.h"
+#include "core/spatial/SpatialHash.h"
+
+using namespace GLaDOS;
+
+// every object looks for its neighbours within 5 units, a tenth of the objects move per frame
+static Scene* makeCrowd(std::size_t count, Vector<GameObject*>& objects) {
+    std::mt19937 random{1};
+    std::uniform_real_distribution<real> distribution{-100, 100};
+    Scene* scene = NEW_T(Scene);
+    for (std::size_t i = 0; i < count; i++) {
+        GameObject* object = scene->createGameObject("agent");
+        object->transform()->setLocalPosition(Vec3{distribution(random), 0, distribution(random)});
+        objects.push_back(object);
+    }
+    return scene;
+}
+
+static void moveTenth(Vector<GameObject*>& objects, std::size_t frame) {
+    for (std::size_t i = frame % 10; i < objects.size(); i += 10) {
+        objects[i]->transform()->translate(Vec3{0.5, 0, 0});
+    }
+}
+
+static void BM_NeighboursLinear(benchmark::State& state) {
+    Vector<GameObject*> objects;
+    Scene* scene = makeCrowd(static_cast<std::size_t>(state.range(0)), objects);
+    std::size_t frame = 0;
+    for (auto _ : state) {
+        moveTenth(objects, frame++);
+        std::size_t found = 0;
+        for (GameObject* object : objects) {
+            Vec3 position = object->transform()->position();
+            for (GameObject* other : objects) {
+                found += other->transform()->position().distanceSquare(position) <= 25 ? 1 : 0;
+            }
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    DELETE_T(scene, Scene);
+}
+
+BENCHMARK(BM_NeighboursLinear)->Arg(1000)->Arg(4000)->Unit(benchmark::kMillisecond);
+
+static void runIndexed(benchmark::State& state, SpatialIndex* index) {
+    Vector<GameObject*> objects;
+    Scene* scene = makeCrowd(static_cast<std::size_t>(state.range(0)), objects);
+    scene->setSpatialIndex(index);
+    Vector<GameObject*> result(objects.size());
+    std::size_t frame = 0;
+    for (auto _ : state) {
+        moveTenth(objects, frame++);
+        std::size_t found = 0;
+        for (GameObject* object : objects) {
+            found += scene->queryRadius(object->transform()->position(), 5, result.data(), result.size());
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    DELETE_T(scene, Scene);
+}
+
+static void BM_NeighboursSpatialHash(benchmark::State& state) {
+    runIndexed(state, NEW_T(SpatialHash)(5));
+}
+
+BENCHMARK(BM_NeighboursSpatialHash)->Arg(1000)->Arg(4000)->Unit(benchmark::kMillisecond);
+
+static void BM_NeighboursLooseOctree(benchmark::State& state) {
+    runIndexed(state, NEW_T(LooseOctree)(Vec3{0, 0, 0}, 128));
+}
+
+BENCHMARK(BM_NeighboursLooseOctree)->Arg(1000)->Arg(4000)->Unit(benchmark::kMillisecond);
@@ -6,6 +6,8 @@
 #include "core/GameObject.hpp"
 #include "core/Scene.h"
 #include "core/SceneManager.h"
+#include "core/spatial/LooseOctree.h"
+#include "core/spatial/SpatialHash.h"
 #include "core/component/Camera.h"
 #include "core/component/renderer/CubemapRenderer.h"
 #include "core/component/renderer/MeshRenderer.h"
@@ -25,6 +27,7 @@
 #include "platform/Input.h"
 #include "platform/InputHandler.h"
 #include "platform/Platform.h"
+#include "platform/HeadlessRunner.h"
 #include "platform/Timer.h"
 #include "platform/render/IndexBuffer.h"
 #include "platform/render/Material.h"
@@ -1,6 +1,18 @@
 #include "Component.h"
 
+#include <atomic>
+
+#include "GameObject.hpp"
+#include "Scene.h"
+
 namespace GLaDOS {
+    ComponentTypeId nextComponentTypeId() {
+        static std::atomic<ComponentTypeId> counter{0};
+        ComponentTypeId id = counter.fetch_add(1, std::memory_order_relaxed);
+        GASSERT(id < maxComponentTypes);
+        return id;
+    }
+
     Component::Component(const std::string& name) {
         mName = name;
     }
@@ -9,7 +21,67 @@ namespace GLaDOS {
         return mGameObject;
     }
 
+    UpdatePhase Component::updatePhase() const {
+        return UpdatePhase::Gameplay;
+    }
+
+    bool Component::isThreadSafe() const {
+        return false;
+    }
+
+    bool Component::needsUpdate() const {
+        return true;
+    }
+
+    void Component::sleep() {
+        mSleepSerial++;
+        mGameObject->setSleeping(mTypeId, true);
+    }
+
+    void Component::sleepFor(real seconds) {
+        sleep();
+        if (mGameObject->scene() != nullptr) {
+            mGameObject->scene()->addWakeTimer(this, seconds);
+        }
+    }
+
+    void Component::wake() {
+        if (!needsUpdate()) {
+            return;
+        }
+        mGameObject->setSleeping(mTypeId, false);
+    }
+
+    bool Component::isSleeping() const {
+        return mGameObject->isSleeping(mTypeId);
+    }
+
+    void Component::setWakeOnMessage(bool value) {
+        mWakeOnMessage = value;
+    }
+
+    void Component::setWakeOnTransformChange(bool value) {
+        ComponentMask bit = ComponentMask{1} << mTypeId;
+        if (value) {
+            mGameObject->mWakeOnMoveMask |= bit;
+        } else {
+            mGameObject->mWakeOnMoveMask &= ~bit;
+        }
+    }
+
     MessageResult Component::handleMessage([[maybe_unused]] Message& msg) {
         return MessageResult::Ignored;
     }
+
+    void Component::onCloned([[maybe_unused]] const CloneMap& clones) {
+    }
+
+    GameObject* Component::cloneOf(const CloneMap& clones, GameObject* original) {
+        for (const auto& [source, copy] : clones) {
+            if (source == original) {
+                return copy;
+            }
+        }
+        return original;
+    }
 }  // namespace GLaDOS
\ No newline at end of file
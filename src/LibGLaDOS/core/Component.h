@@ -5,11 +5,52 @@
 #include "Object.h"
 #include "utils/Enumeration.h"
 #include "Cloneable.h"
+#include "memory/HandlePool.hpp"
 
 namespace GLaDOS {
+    using ComponentTypeId = uint32_t;
+    using ComponentMask = uint64_t;  // bit `n` is set when the component of type id `n` is present
+    constexpr static std::size_t maxComponentTypes = sizeof(ComponentMask) * 8;
+
+    // Hands out ids in first use order. Lives in a single translation unit, so ids are unique across the program.
+    extern ComponentTypeId nextComponentTypeId();
+
+    // Small integer id of a component type, used instead of typeid/type_index to index component tables.
+    template <typename T>
+    ComponentTypeId componentTypeId() {
+        static const ComponentTypeId id = nextComponentTypeId();
+        return id;
+    }
+
+    class Component;
+
+    // Operations on the HandlePool of one component type, shared by all components allocated from it.
+    struct ComponentPool {
+        void (*release)(Component*);  // destroys the component and returns its slot
+        bool (*reserve)(std::size_t count);  // makes room for `count` more components
+    };
+
+    template <typename T>
+    const ComponentPool* componentPool() {
+        static const ComponentPool pool{
+            [](Component* component) { HandlePool<T>::getInstance().destroy(static_cast<T*>(component)); },
+            [](std::size_t count) {
+                HandlePool<T>& handlePool = HandlePool<T>::getInstance();
+                return handlePool.reserve(handlePool.size() + count);
+            }};
+        return &pool;
+    }
+
     class GameObject;
+    // objects of a cloned hierarchy paired with their copies, in cloning order
+    using CloneMap = Vector<std::pair<GameObject*, GameObject*>>;
+
     class Component : public Object, Cloneable<Component> {
         friend class GameObject;
+        friend class ComponentStore;
+        friend class MessageBus;
+        friend class SceneRegistry;
+        friend class Scene;
 
       public:
         Component(const std::string& name);
@@ -21,12 +62,60 @@ namespace GLaDOS {
         Component& operator=(Component&& other) = delete;
 
         GameObject* gameObject();
+        // phase of a parallel scene update the component runs in, see Scene::setUpdateThreadPool
+        virtual UpdatePhase updatePhase() const;
+        // true if update/fixedUpdate only touch the own game object and never read world matrices,
+        // so they may run on a worker thread. otherwise they run on the main thread. moving the own transform
+        // is fine, children see the change and wake after the phase.
+        virtual bool isThreadSafe() const;
+        // false if update and fixedUpdate have nothing to do, the component is never ticked then.
+        // it still renders and handles messages.
+        virtual bool needsUpdate() const;
+
+        // Skips update and fixedUpdate until the component is woken. Objects whose components all sleep are
+        // not visited by the scene update at all. May be called from update of the component itself.
+        void sleep();
+        void sleepFor(real seconds);  // wakes after `seconds` of scene time
+        void wake();
+        bool isSleeping() const;
+        // wake conditions of a sleeping component, off by default
+        void setWakeOnMessage(bool value);
+        void setWakeOnTransformChange(bool value);  // the transform of the object or of a parent changed
 
       protected:
         virtual MessageResult handleMessage(Message& msg);
+        // Called on the copies once the whole hierarchy is cloned, so references into it can be remapped.
+        virtual void onCloned(const CloneMap& clones);
+        // copy of `original`, or `original` itself when it is outside the cloned hierarchy
+        static GameObject* cloneOf(const CloneMap& clones, GameObject* original);
+        // Creates a component in the HandlePool of T like GameObject::addComponent does. clone() should create
+        // its copy with it, otherwise the clone has no handle and Scene::instantiateMany can not reserve for it.
+        template <typename T, typename... Ts>
+        static T* newComponent(Ts&&... args);
 
-        GameObject* mGameObject;  // NOTE: do not initialize game object.
+        GameObject* mGameObject{nullptr};  // set once the component is constructed, not usable in constructors
+
+      private:
+        static constexpr uint32_t unregistered = UINT32_MAX;
+
+        ComponentTypeId mTypeId{0};  // set by GameObject::addComponent
+        const ComponentPool* mPool{nullptr};  // HandlePool the component lives in, nullptr if heap allocated
+        uint32_t mRegistrySlot{unregistered};  // position in the SceneRegistry of the scene
+        uint32_t mSleepSerial{0};  // bumped by sleep(), a wake timer of an earlier sleep is ignored
+        uint32_t mWakeTimerCount{0};  // wake timers of the scene pointing at this component
+        bool mWakeOnMessage{false};
     };
+
+    template <typename T, typename... Ts>
+    T* Component::newComponent(Ts&&... args) {
+        T* component = HandlePool<T>::getInstance().allocate();
+        if (component == nullptr) {
+            return nullptr;
+        }
+        new (component) T(std::forward<Ts>(args)...);
+        component->mPool = componentPool<T>();
+        return component;
+    }
 }  // namespace GLaDOS
 
 #endif  //GLADOS_COMPONENT_H
@@ -0,0 +1,205 @@
+#include "ComponentStore.hpp"
+
+namespace GLaDOS {
+    ComponentMask Archetype::signature() const {
+        return mSignature;
+    }
+
+    std::size_t Archetype::size() const {
+        return mGameObjects.size();
+    }
+
+    std::size_t Archetype::awakeCount() const {
+        return mAwakeCount;
+    }
+
+    GameObject* Archetype::gameObjectAt(std::size_t row) const {
+        return mGameObjects[row];
+    }
+
+    int Archetype::columnOf(ComponentTypeId id) const {
+        if (id >= maxComponentTypes || (mSignature >> id & 1) == 0) {
+            return -1;
+        }
+        // columns of lower type ids come first
+        return static_cast<int>(popCount(mSignature & ((ComponentMask{1} << id) - 1)));
+    }
+
+    const Vector<Component*>& Archetype::column(std::size_t index) const {
+        return mColumns[index];
+    }
+
+    ComponentStore::~ComponentStore() {
+        for (Archetype* archetype : mArchetypes) {
+            for (GameObject* gameObject : archetype->mGameObjects) {
+                gameObject->mArchetype = nullptr;
+            }
+        }
+        deallocIterable(mArchetypes);
+        mLookup.clear();
+    }
+
+    void ComponentStore::insert(GameObject* gameObject) {
+        refresh(gameObject);
+    }
+
+    void ComponentStore::remove(GameObject* gameObject) {
+        detach(gameObject);
+    }
+
+    void ComponentStore::refresh(GameObject* gameObject) {
+        ComponentMask signature = gameObject->mComponentMask;
+        if (gameObject->mArchetype != nullptr && gameObject->mArchetype->mSignature == signature) {
+            // same component types, but a component may have been replaced
+            Archetype* archetype = gameObject->mArchetype;
+            std::size_t column = 0;
+            gameObject->forEachComponent([archetype, gameObject, &column](Component* component) {
+                archetype->mColumns[column++][gameObject->mArchetypeRow] = component;
+            });
+            return;
+        }
+
+        detach(gameObject);
+        Archetype* archetype = findOrCreate(signature);
+        gameObject->mArchetype = archetype;
+        gameObject->mArchetypeRow = archetype->mGameObjects.size();
+        archetype->mGameObjects.push_back(gameObject);
+        std::size_t column = 0;
+        gameObject->forEachComponent([archetype, &column](Component* component) {
+            archetype->mColumns[column++].push_back(component);
+        });
+        refreshSleep(gameObject);
+    }
+
+    void ComponentStore::refreshSleep(GameObject* gameObject) {
+        Archetype* archetype = gameObject->mArchetype;
+        if (archetype == nullptr) {
+            return;
+        }
+
+        // the first sleeping row or the last awake row trades places with the object
+        std::size_t row = gameObject->mArchetypeRow;
+        bool awake = gameObject->isAwake();
+        if (awake && row >= archetype->mAwakeCount) {
+            swapRows(archetype, row, archetype->mAwakeCount);
+            archetype->mAwakeCount++;
+        } else if (!awake && row < archetype->mAwakeCount) {
+            archetype->mAwakeCount--;
+            swapRows(archetype, row, archetype->mAwakeCount);
+        }
+    }
+
+    void ComponentStore::fixedUpdate(real fixedDeltaTime) {
+        // indexed like update(), components may change the archetypes while they run
+        std::size_t archetypeCount = mArchetypes.size();
+        for (std::size_t index = 0; index < archetypeCount; index++) {
+            Archetype* archetype = mArchetypes[index];
+            std::size_t rowCount = archetype->mAwakeCount;
+            for (std::size_t column = 0; column < archetype->mColumns.size(); column++) {
+                for (std::size_t row = std::min(rowCount, archetype->mGameObjects.size()); row-- > 0;) {
+                    if (row >= archetype->mGameObjects.size()) {
+                        // a component removed several rows of this archetype
+                        continue;
+                    }
+                    GameObject* gameObject = archetype->mGameObjects[row];
+                    Component* component = archetype->mColumns[column][row];
+                    if (gameObject->isActive() && !gameObject->isSleeping(component->mTypeId) && component->isActive()) {
+                        component->fixedUpdate(fixedDeltaTime);
+                    }
+                }
+            }
+        }
+    }
+
+    void ComponentStore::update(real deltaTime) {
+        // components may add or remove components while they update, which creates archetypes and moves rows.
+        // rows are indexed and checked against the current size, iterators would dangle. rows run backwards,
+        // so a row leaving swaps in one that already ran, and archetypes created during the pass wait for the
+        // next one. an object changing its component set misses the columns of this frame that had not run yet.
+        // only the awake rows are visited, sleeping objects trade places with them between passes.
+        std::size_t archetypeCount = mArchetypes.size();
+        for (std::size_t index = 0; index < archetypeCount; index++) {
+            Archetype* archetype = mArchetypes[index];
+            std::size_t rowCount = archetype->mAwakeCount;
+            for (std::size_t column = 0; column < archetype->mColumns.size(); column++) {
+                for (std::size_t row = std::min(rowCount, archetype->mGameObjects.size()); row-- > 0;) {
+                    if (row >= archetype->mGameObjects.size()) {
+                        // a component removed several rows of this archetype
+                        continue;
+                    }
+                    GameObject* gameObject = archetype->mGameObjects[row];
+                    Component* component = archetype->mColumns[column][row];
+                    if (gameObject->isActive() && !gameObject->isSleeping(component->mTypeId) && component->isActive()) {
+                        component->update(deltaTime);
+                    }
+                }
+            }
+        }
+    }
+
+    std::size_t ComponentStore::archetypeCount() const {
+        return mArchetypes.size();
+    }
+
+    const Vector<Archetype*>& ComponentStore::archetypes() const {
+        return mArchetypes;
+    }
+
+    Archetype* ComponentStore::findOrCreate(ComponentMask signature) {
+        auto iter = mLookup.find(signature);
+        if (iter != mLookup.end()) {
+            return iter->second;
+        }
+
+        Archetype* archetype = NEW_T(Archetype);
+        archetype->mSignature = signature;
+        archetype->mColumns.resize(popCount(signature));
+        mArchetypes.push_back(archetype);
+        mLookup.emplace(signature, archetype);
+        return archetype;
+    }
+
+    void ComponentStore::detach(GameObject* gameObject) {
+        Archetype* archetype = gameObject->mArchetype;
+        if (archetype == nullptr) {
+            return;
+        }
+
+        // an awake row first trades places with the last awake row, so the awake rows stay in front
+        std::size_t row = gameObject->mArchetypeRow;
+        if (row < archetype->mAwakeCount) {
+            archetype->mAwakeCount--;
+            swapRows(archetype, row, archetype->mAwakeCount);
+            row = archetype->mAwakeCount;
+        }
+
+        // swap and pop, the last row takes the place of the removed one
+        std::size_t last = archetype->mGameObjects.size() - 1;
+        if (row != last) {
+            GameObject* moved = archetype->mGameObjects[last];
+            archetype->mGameObjects[row] = moved;
+            moved->mArchetypeRow = row;
+            for (auto& column : archetype->mColumns) {
+                column[row] = column[last];
+            }
+        }
+        archetype->mGameObjects.pop_back();
+        for (auto& column : archetype->mColumns) {
+            column.pop_back();
+        }
+        gameObject->mArchetype = nullptr;
+        gameObject->mArchetypeRow = 0;
+    }
+
+    void ComponentStore::swapRows(Archetype* archetype, std::size_t lhs, std::size_t rhs) {
+        if (lhs == rhs) {
+            return;
+        }
+        std::swap(archetype->mGameObjects[lhs], archetype->mGameObjects[rhs]);
+        archetype->mGameObjects[lhs]->mArchetypeRow = lhs;
+        archetype->mGameObjects[rhs]->mArchetypeRow = rhs;
+        for (auto& column : archetype->mColumns) {
+            std::swap(column[lhs], column[rhs]);
+        }
+    }
+}  // namespace GLaDOS
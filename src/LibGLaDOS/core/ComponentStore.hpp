@@ -0,0 +1,105 @@
+#ifndef GLADOS_COMPONENTSTORE_HPP
+#define GLADOS_COMPONENTSTORE_HPP
+
+#include <utility>
+
+#include "GameObject.hpp"
+
+namespace GLaDOS {
+    // Game objects which have exactly the same set of component types. Rows are objects and
+    // every column holds the components of one type, so a system walks plain arrays.
+    class Archetype {
+        friend class ComponentStore;
+
+      public:
+        ComponentMask signature() const;
+        std::size_t size() const;
+        std::size_t awakeCount() const;  // rows before this have a component that is not sleeping
+        GameObject* gameObjectAt(std::size_t row) const;
+        int columnOf(ComponentTypeId id) const;  // -1 if the archetype has no such component
+        const Vector<Component*>& column(std::size_t index) const;
+
+      private:
+        ComponentMask mSignature{0};  // columns are in type id order
+        Vector<GameObject*> mGameObjects;
+        Vector<Vector<Component*>> mColumns;  // row aligned with mGameObjects
+        std::size_t mAwakeCount{0};  // awake objects come first, update stops at the sleeping ones
+    };
+
+    // Opt-in archetype index of a scene (see Scene::enableComponentStore). Components stay in their
+    // per-type HandlePool, so addComponent/getComponent keep working and pointers stay valid.
+    // The component set of an object must not change while iterating.
+    class ComponentStore {
+      public:
+        ComponentStore() = default;
+        ~ComponentStore();
+
+        void insert(GameObject* gameObject);
+        void remove(GameObject* gameObject);
+        // moves the object to the archetype of its current component set
+        void refresh(GameObject* gameObject);
+        // moves the row of the object to the awake or the sleeping rows of its archetype, see Scene::applySchedule
+        void refreshSleep(GameObject* gameObject);
+
+        // visits every object having all of Ts, function(GameObject*, Ts&...)
+        template <typename... Ts, typename Function>
+        void forEach(Function&& function);
+
+        // update components column by column instead of object by object
+        void fixedUpdate(real fixedDeltaTime);
+        void update(real deltaTime);
+
+        std::size_t archetypeCount() const;
+        const Vector<Archetype*>& archetypes() const;
+
+        DISALLOW_COPY_AND_ASSIGN(ComponentStore);
+
+      private:
+        Archetype* findOrCreate(ComponentMask signature);
+        void detach(GameObject* gameObject);
+        static void swapRows(Archetype* archetype, std::size_t lhs, std::size_t rhs);
+        template <typename... Ts, typename Function, std::size_t... Is>
+        static void invokeRow(Function& function, GameObject* gameObject, Component* const* components, std::index_sequence<Is...>);
+
+        Vector<Archetype*> mArchetypes;
+        UnorderedMap<ComponentMask, Archetype*> mLookup;
+    };
+
+    template <typename... Ts, typename Function>
+    void ComponentStore::forEach(Function&& function) {
+        static_assert(sizeof...(Ts) > 0, "at least one component type is required");
+        ComponentTypeId ids[] = {componentTypeId<Ts>()...};
+        ComponentMask required = 0;
+        for (ComponentTypeId id : ids) {
+            if (id >= maxComponentTypes) {
+                return;
+            }
+            required |= ComponentMask{1} << id;
+        }
+
+        for (Archetype* archetype : mArchetypes) {
+            if (archetype->size() == 0 || (archetype->mSignature & required) != required) {
+                continue;
+            }
+            int columns[sizeof...(Ts)];
+            for (std::size_t i = 0; i < sizeof...(Ts); i++) {
+                columns[i] = archetype->columnOf(ids[i]);
+            }
+
+            for (std::size_t row = 0; row < archetype->size(); row++) {
+                Component* components[sizeof...(Ts)];
+                for (std::size_t i = 0; i < sizeof...(Ts); i++) {
+                    components[i] = archetype->mColumns[columns[i]][row];
+                }
+                invokeRow<Ts...>(function, archetype->mGameObjects[row], components, std::index_sequence_for<Ts...>{});
+            }
+        }
+    }
+
+    template <typename... Ts, typename Function, std::size_t... Is>
+    void ComponentStore::invokeRow(Function& function, GameObject* gameObject, Component* const* components, std::index_sequence<Is...>) {
+        function(gameObject, *static_cast<Ts*>(components[Is])...);
+    }
+}  // namespace GLaDOS
+
+#endif  //GLADOS_COMPONENTSTORE_HPP
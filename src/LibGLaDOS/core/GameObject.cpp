@@ -1,6 +1,9 @@
 #include "GameObject.hpp"
 
+#include "ComponentStore.hpp"
 #include "Scene.h"
+#include "SceneRegistry.h"
+#include "TransformHierarchy.h"
 #include "core/component/Transform.h"
 
 namespace GLaDOS {
@@ -41,10 +44,25 @@ namespace GLaDOS {
 
     GameObject::~GameObject() {
         // don't dealloc children here. because they are freed in scene destructor.
-        deallocValueInMap(mComponents);
+        forEachComponent([](Component* component) {
+            releaseComponent(component);
+        });
+        std::fill(std::begin(mComponents), std::end(mComponents), nullptr);
+        mComponentMask = 0;
         mChildren.clear();
     }
 
+    void GameObject::releaseComponent(Component* component) {
+        if (component == nullptr) {
+            return;
+        }
+        if (component->mPool != nullptr) {
+            component->mPool->release(component);
+            return;
+        }
+        DELETE_T(component, Component);
+    }
+
     void GameObject::setActiveRecursive(bool value) {
         active(value);
         for (auto& i : mChildren) {
@@ -55,13 +73,13 @@ namespace GLaDOS {
     void GameObject::sendMessageUpwards(Message& msg) {
         MessageType type = msg.type();
         for (const auto& componentInSelf : mSubscriber[type]) {
-            componentInSelf->handleMessage(msg);
+            deliverMessage(componentInSelf, msg);
         }
 
         GameObject* parent = mParent;
         while (parent != nullptr) {
             for (const auto& componentInParent : parent->mSubscriber[type]) {
-                componentInParent->handleMessage(msg);
+                deliverMessage(componentInParent, msg);
             }
             parent = parent->mParent;
         }
@@ -70,7 +88,7 @@ namespace GLaDOS {
     void GameObject::broadcastMessage(Message& msg) {
         MessageType type = msg.type();
         for (const auto& componentInSelf : mSubscriber[type]) {
-            componentInSelf->handleMessage(msg);
+            deliverMessage(componentInSelf, msg);
         }
 
         if (mChildren.empty()) {
@@ -79,11 +97,76 @@ namespace GLaDOS {
 
         for (auto& childGameObject : mChildren) {
             for (const auto& componentInChild : childGameObject->mSubscriber[type]) {
-                componentInChild->handleMessage(msg);
+                deliverMessage(componentInChild, msg);
             }
         }
     }
 
+    void GameObject::onComponentsChanged() {
+        std::fill(std::begin(mPhaseMasks), std::end(mPhaseMasks), 0);
+        mThreadSafeMask = 0;
+        forEachComponent([this](Component* component) {
+            ComponentMask bit = ComponentMask{1} << component->mTypeId;
+            mPhaseMasks[static_cast<int>(component->updatePhase())] |= bit;
+            if (component->isThreadSafe()) {
+                mThreadSafeMask |= bit;
+            }
+        });
+
+        if (mScene != nullptr) {
+            mScene->scheduleObject(this);
+            mScene->registry()->refresh(this);
+            if (mScene->componentStore() != nullptr) {
+                mScene->componentStore()->refresh(this);
+            }
+        }
+    }
+
+    void GameObject::unregisterComponent(Component* component) {
+        if (mScene != nullptr) {
+            mScene->registry()->removeComponent(component);
+            mScene->cancelWakeTimers(component);
+        }
+    }
+
+    void GameObject::setSleeping(ComponentTypeId id, bool sleeping) {
+        ComponentMask bit = ComponentMask{1} << id;
+        ComponentMask mask = sleeping ? mSleepMask | bit : mSleepMask & ~bit;
+        if (mask == mSleepMask) {
+            return;
+        }
+        mSleepMask = mask;
+        if (mScene != nullptr) {
+            mScene->scheduleObject(this);
+        }
+    }
+
+    void GameObject::wakeOnTransformChange() {
+        ComponentMask mask = mSleepMask & mWakeOnMoveMask;
+        while (mask != 0) {
+            Component* component = mComponents[countTrailingZero(mask)];
+            mask &= mask - 1;
+            if (component != nullptr) {
+                component->wake();
+            }
+        }
+    }
+
+    void GameObject::deliverMessage(Component* component, Message& msg) {
+        if (component->mWakeOnMessage) {
+            component->wake();
+        }
+        component->handleMessage(msg);
+    }
+
+    Handle<GameObject> GameObject::handle() const {
+        return mHandle;
+    }
+
+    bool GameObject::isPendingDestroy() const {
+        return mPendingDestroy;
+    }
+
     Transform* GameObject::transform() {
         return mTransform;
     }
@@ -97,11 +180,15 @@ namespace GLaDOS {
     }
 
     void GameObject::setLayer(uint32_t layer) {
-        if (layer >= 64) {
-            LOG_ERROR(logger, "Layer should not be greater than 64 but {0}", layer);
+        if (layer >= SceneRegistry::maxLayers) {
+            LOG_ERROR(logger, "Layer should not be greater than {0} but {1}", SceneRegistry::maxLayers, layer);
             return;
         }
 
+        if (mScene != nullptr) {
+            mScene->registry()->changeLayer(this, layer);
+            return;
+        }
         mLayer = layer;
     }
 
@@ -109,6 +196,10 @@ namespace GLaDOS {
         return mChildren;
     }
 
+    FrameVector<GameObject*> GameObject::getChildrenInFrame() const {
+        return FrameVector<GameObject*>(mChildren.begin(), mChildren.end());
+    }
+
     Transform* GameObject::parent() const {
         if (mParent == nullptr) {
             return nullptr;
@@ -138,63 +229,122 @@ namespace GLaDOS {
     }
 
     GameObject* GameObject::clone() {
-        GameObject* clone = NEW_T(GameObject(mParent, mScene));
+        CloneMap clones;
+        GameObject* clone = cloneInto(mParent, clones);
+        // every copy exists now, components may point their references at them
+        for (const auto& [original, copy] : clones) {
+            copy->forEachComponent([&clones](Component* component) {
+                component->onCloned(clones);
+            });
+        }
+        return clone;
+    }
+
+    GameObject* GameObject::cloneInto(GameObject* parent, CloneMap& clones) {
+        HandlePool<GameObject>& pool = HandlePool<GameObject>::getInstance();
+        void* storage = pool.allocate();
+        if (storage == nullptr) {
+            return nullptr;
+        }
+        GameObject* clone = new (storage) GameObject(parent, mScene);
+        clone->mHandle = pool.handleOf(clone);
         clone->mName = mName + " (duplicated)";
         clone->mIsActive = mIsActive;
+        clones.emplace_back(this, clone);
 
         // clone components in game object
-        for (const auto& [key, value] : mComponents) {
+        forEachComponent([clone](Component* value) {
             Component* component = value->clone();
+            if (component == nullptr) {
+                LOG_WARN(logger, "component `{0}` can not be cloned", value->getName());
+                return;
+            }
             component->mGameObject = clone;
-            clone->mComponents.try_emplace(std::type_index(typeid(*value)), component);
-        }
+            component->mTypeId = value->mTypeId;
+            clone->mComponents[value->mTypeId] = component;
+            clone->mComponentMask |= ComponentMask{1} << value->mTypeId;
+            if (!component->needsUpdate()) {
+                clone->mSleepMask |= ComponentMask{1} << value->mTypeId;
+            }
+        });
         clone->mTransform = clone->getComponent<Transform>();
+        if (mScene != nullptr) {
+            // skipped while the clone had no transform yet
+            mScene->transformHierarchy()->insert(clone);
+        }
 
-        // clone children of game object `recursively`
-        // TODO: fix clone bug
-        for (GameObject* children : mChildren) {
-            clone->mChildren.emplace_back(children->clone());
+        // clone children of game object `recursively`, the constructor links them to the clone
+        for (GameObject* child : mChildren) {
+            child->cloneInto(clone, clones);
         }
 
         // clone subscriber set
         for (std::size_t i = 0; i < MessageType::size(); i++) {
             for (const auto& comp : mSubscriber[i]) {
-                auto iter = clone->mComponents.find(std::type_index(typeid(*comp)));
-                if (iter == clone->mComponents.end()) {
-                    LOG_WARN(logger, "miss out subscriber component `{0}`", iter->second->mName);
+                if (!clone->hasComponent(comp->mTypeId)) {
+                    LOG_WARN(logger, "miss out subscriber component `{0}`", comp->getName());
                     continue;
                 }
-                clone->mSubscriber[i].insert(iter->second);
+                clone->mSubscriber[i].push_back(clone->mComponents[comp->mTypeId]);
             }
         }
 
         // and last copy layer value
-        clone->mLayer = mLayer;
+        clone->setLayer(mLayer);
+        clone->onComponentsChanged();
 
         return clone;
     }
 
     void GameObject::fixedUpdate(real fixedDeltaTime) {
-        for (auto& comp : mComponents) {
-            if (comp.second->isActive()) {
-                comp.second->fixedUpdate(fixedDeltaTime);
+        ComponentMask mask = mComponentMask & ~mSleepMask;
+        while (mask != 0) {
+            Component* component = mComponents[countTrailingZero(mask)];
+            mask &= mask - 1;
+            if (component != nullptr && component->isActive()) {
+                component->fixedUpdate(fixedDeltaTime);
             }
         }
     }
 
     void GameObject::update(real deltaTime) {
-        for (auto& comp : mComponents) {
-            if (comp.second->isActive()) {
-                comp.second->update(deltaTime);
+        ComponentMask mask = mComponentMask & ~mSleepMask;
+        while (mask != 0) {
+            Component* component = mComponents[countTrailingZero(mask)];
+            mask &= mask - 1;
+            if (component != nullptr && component->isActive()) {
+                component->update(deltaTime);
             }
         }
     }
 
-    void GameObject::render() {
-        for (auto& comp : mComponents) {
-            if (comp.second->isActive()) {
-                comp.second->render();
+    void GameObject::fixedUpdate(real fixedDeltaTime, UpdatePhase phase, bool threadSafe) {
+        ComponentMask mask = phaseMask(phase, threadSafe);
+        while (mask != 0) {
+            Component* component = mComponents[countTrailingZero(mask)];
+            mask &= mask - 1;
+            if (component != nullptr && component->isActive()) {
+                component->fixedUpdate(fixedDeltaTime);
+            }
+        }
+    }
+
+    void GameObject::update(real deltaTime, UpdatePhase phase, bool threadSafe) {
+        ComponentMask mask = phaseMask(phase, threadSafe);
+        while (mask != 0) {
+            Component* component = mComponents[countTrailingZero(mask)];
+            mask &= mask - 1;
+            if (component != nullptr && component->isActive()) {
+                component->update(deltaTime);
             }
         }
     }
+
+    void GameObject::render() {
+        forEachComponent([](Component* component) {
+            if (component->isActive()) {
+                component->render();
+            }
+        });
+    }
 }  // namespace GLaDOS
\ No newline at end of file
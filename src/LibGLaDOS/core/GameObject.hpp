@@ -1,8 +1,7 @@
 #ifndef GLADOS_GAMEOBJECT_HPP
 #define GLADOS_GAMEOBJECT_HPP
 
-#include <typeindex>
-#include <typeinfo>
+#include <algorithm>
 
 #include "Component.h"
 #include "Message.h"
@@ -10,15 +9,23 @@
 #include "utils/Enumeration.h"
 #include "utils/Utility.h"
 #include "Cloneable.h"
+#include "memory/FrameArena.h"
+#include "memory/HandlePool.hpp"
 
 namespace GLaDOS {
     class Logger;
     class Scene;
     class Transform;
     class Component;
+    class Archetype;
     class GameObject : public Object, Cloneable<GameObject> {
         friend class Scene;
         friend class Transform;
+        friend class ComponentStore;
+        friend class TransformHierarchy;
+        friend class MessageBus;
+        friend class SceneRegistry;
+        friend class Component;
 
       public:
         GameObject(std::string name, Scene* scene);
@@ -35,6 +42,9 @@ namespace GLaDOS {
         template <typename T>
         T* getComponent();
         template <typename T>
+        Handle<T> getComponentHandle();
+        // depth first through every descendant, not including this object
+        template <typename T>
         T* getComponentInChildren();
         template <typename T>
         T* getComponentInParent();
@@ -47,11 +57,18 @@ namespace GLaDOS {
         bool sendMessage(Message& msg);
         void sendMessageUpwards(Message& msg);
         void broadcastMessage(Message& msg);
+        template <typename T>
+        bool subscribeToMessageType(MessageType type);
+        template <typename T>
+        bool subscribeAllMessageType();
+        Handle<GameObject> handle() const;  // null for objects not created by Scene
+        bool isPendingDestroy() const;  // destroyed, alive until the end of the frame
         Transform* transform();
         Scene* scene();
         uint32_t getLayer() const;
         void setLayer(uint32_t layer);
         Vector<GameObject*> getChildren() const;
+        FrameVector<GameObject*> getChildrenInFrame() const;  // copy lives in FrameArena, valid until end of next frame
         Transform* parent() const;
         Vector<GameObject*>::iterator findInChildren(const GameObject* target);
         bool addChildren(GameObject* target);
@@ -65,47 +82,99 @@ namespace GLaDOS {
 
       private:
         static Logger* logger;
-        GameObject(GameObject* parent, Scene* scene);
+        static constexpr uint32_t unregistered = UINT32_MAX;
 
-        template <typename T>
-        bool subscribeToMessageType(MessageType type);
-        template <typename T>
-        bool subscribeAllMessageType();
+        GameObject(GameObject* parent, Scene* scene);
+        static void releaseComponent(Component* component);
+        void unregisterComponent(Component* component);  // from the SceneRegistry, before it is released
+        GameObject* cloneInto(GameObject* parent, CloneMap& clones);
+        void onComponentsChanged();
+        bool hasComponent(ComponentTypeId id) const;
+        // runs components of one phase, either the thread safe ones or the others
+        void fixedUpdate(real fixedDeltaTime, UpdatePhase phase, bool threadSafe);
+        void update(real deltaTime, UpdatePhase phase, bool threadSafe);
+        ComponentMask phaseMask(UpdatePhase phase, bool threadSafe) const;
+        void setSleeping(ComponentTypeId id, bool sleeping);
+        bool isSleeping(ComponentTypeId id) const;
+        bool isAwake() const;  // has a component that is not sleeping
+        void wakeOnTransformChange();  // called by Transform::dirty
+        // wakes the component first if it asked for it, see Component::setWakeOnMessage
+        static void deliverMessage(Component* component, Message& msg);
+        static bool addSubscriber(Vector<Component*>& subscribers, Component* component);
+        // visits present components in type id order, components added meanwhile are not visited
+        template <typename Function>
+        void forEachComponent(Function&& function);
 
+        Handle<GameObject> mHandle;
         Scene* mScene{nullptr};
         GameObject* mParent{nullptr};
         Transform* mTransform{nullptr};
-        Set<Component*> mSubscriber[MessageType::size()];
-        UnorderedMap<std::type_index, Component*> mComponents;
+        Vector<Component*> mSubscriber[MessageType::size()];  // flat, an object has a handful of subscribers
+        ComponentMask mComponentMask{0};
+        Component* mComponents[maxComponentTypes]{};  // indexed by component type id
+        ComponentMask mPhaseMasks[static_cast<int>(UpdatePhase::TheNumberOfPhase)]{};
+        ComponentMask mThreadSafeMask{0};
+        ComponentMask mSleepMask{0};  // components skipped by update, see Component::sleep
+        ComponentMask mWakeOnMoveMask{0};
         Vector<GameObject*> mChildren;
         uint32_t mLayer{0}; // default layer 0
+        uint32_t mLayerSlot{unregistered};  // position in the layer of the SceneRegistry
+        uint32_t mSceneIndex{0};  // position in the game objects of the scene
+        uint32_t mDestroyQueueIndex{0};
+        uint32_t mAwakeSlot{unregistered};  // position in the awake objects of the scene
+        bool mPendingDestroy{false};
+        bool mScheduleQueued{false};  // sleep state changed, the scene applies it before the next update
+        Archetype* mArchetype{nullptr};  // set while the scene uses a ComponentStore
+        std::size_t mArchetypeRow{0};
     };
 
     template <typename T, typename, typename, typename... Ts>
     T* GameObject::addComponent(Ts... args) {
-        // duplicate key check by runtime RTTI
-        if (mComponents.find(std::type_index(typeid(T))) != mComponents.end()) {
+        ComponentTypeId id = componentTypeId<T>();
+        if (id >= maxComponentTypes) {
+            LOG_ERROR(logger, "too many component types, at most {0} are supported", maxComponentTypes);
+            return static_cast<T*>(nullptr);
+        }
+        if (hasComponent(id)) {
             return static_cast<T*>(nullptr);
         }
 
-        T* component = static_cast<T*>(MALLOC(sizeof(T)));
+        // components of the same type share a slab, see HandlePool
+        T* component = HandlePool<T>::getInstance().allocate();
         if (!component) {
             return static_cast<T*>(nullptr);
         }
-        component->mGameObject = this;
         new (component) T(args...);
-        mComponents.try_emplace(std::type_index(typeid(T)), component);
+        component->mGameObject = this;
+        component->mTypeId = id;
+        component->mPool = componentPool<T>();
+        mComponents[id] = component;
+        mComponentMask |= ComponentMask{1} << id;
+        if (!component->needsUpdate()) {
+            mSleepMask |= ComponentMask{1} << id;
+        }
+        onComponentsChanged();
 
         return component;
     }
 
     template <typename T>
     T* GameObject::getComponent() {
-        auto iter = mComponents.find(std::type_index(typeid(T)));
-        if (iter == mComponents.end()) {
+        ComponentTypeId id = componentTypeId<T>();
+        if (!hasComponent(id)) {
             return static_cast<T*>(nullptr);
         }
-        return static_cast<T*>(iter->second);
+        return static_cast<T*>(mComponents[id]);
+    }
+
+    template <typename T>
+    Handle<T> GameObject::getComponentHandle() {
+        T* component = getComponent<T>();
+        if (component == nullptr || component->mPool != componentPool<T>()) {
+            // heap allocated, e.g. cloned without Component::newComponent
+            return Handle<T>{};
+        }
+        return HandlePool<T>::getInstance().handleOf(component);
     }
 
     template <typename T>
@@ -115,6 +184,10 @@ namespace GLaDOS {
             if (value) {
                 return value;
             }
+            value = gameObject->getComponentInChildren<T>();
+            if (value) {
+                return value;
+            }
         }
 
         return static_cast<T*>(nullptr);
@@ -137,18 +210,23 @@ namespace GLaDOS {
 
     template <typename T>
     bool GameObject::removeComponent() {
-        auto iter = mComponents.find(std::type_index(typeid(T)));
-        if (iter == mComponents.end()) {
-            LOG_WARN(logger, "can't find component `{0}`", typeid(T).name());
+        ComponentTypeId id = componentTypeId<T>();
+        if (!hasComponent(id)) {
+            LOG_WARN(logger, "can't find component to remove in game object `{0}`", mName);
             return false;
         }
 
-        if (iter->second) {
-            iter->second->~Component();
-            FREE(iter->second);
-            iter->second = nullptr;
+        Component* component = mComponents[id];
+        for (auto& subscriber : mSubscriber) {
+            subscriber.erase(std::remove(subscriber.begin(), subscriber.end(), component), subscriber.end());
         }
-        mComponents.erase(iter);
+        unregisterComponent(component);
+        releaseComponent(component);
+        mComponents[id] = nullptr;
+        mComponentMask &= ~(ComponentMask{1} << id);
+        mSleepMask &= ~(ComponentMask{1} << id);
+        mWakeOnMoveMask &= ~(ComponentMask{1} << id);
+        onComponentsChanged();
         return true;
     }
 
@@ -162,7 +240,7 @@ namespace GLaDOS {
         MessageType type = msg.type();
         for (const auto& component : mSubscriber[type]) {
             if (component == ret) {
-                component->handleMessage(msg);
+                deliverMessage(component, msg);
                 break;
             }
         }
@@ -176,7 +254,7 @@ namespace GLaDOS {
             LOG_WARN(logger, "failed to subscribe message type `{0}` in game object `{1}`", type, mName);
             return false;
         }
-        return mSubscriber[type].insert(ret).second;
+        return addSubscriber(mSubscriber[type], ret);
     }
 
     template <typename T>
@@ -187,10 +265,46 @@ namespace GLaDOS {
             return false;
         }
         for (auto& subscriber : mSubscriber) {
-            subscriber.insert(ret);
+            addSubscriber(subscriber, ret);
+        }
+        return true;
+    }
+
+    inline bool GameObject::hasComponent(ComponentTypeId id) const {
+        return id < maxComponentTypes && (mComponentMask >> id & 1) != 0;
+    }
+
+    inline ComponentMask GameObject::phaseMask(UpdatePhase phase, bool threadSafe) const {
+        return mPhaseMasks[static_cast<int>(phase)] & ~mSleepMask & (threadSafe ? mThreadSafeMask : ~mThreadSafeMask);
+    }
+
+    inline bool GameObject::isSleeping(ComponentTypeId id) const {
+        return (mSleepMask >> id & 1) != 0;
+    }
+
+    inline bool GameObject::isAwake() const {
+        return (mComponentMask & ~mSleepMask) != 0;
+    }
+
+    inline bool GameObject::addSubscriber(Vector<Component*>& subscribers, Component* component) {
+        if (std::find(subscribers.begin(), subscribers.end(), component) != subscribers.end()) {
+            return false;
         }
+        subscribers.push_back(component);
         return true;
     }
+
+    template <typename Function>
+    void GameObject::forEachComponent(Function&& function) {
+        ComponentMask mask = mComponentMask;
+        while (mask != 0) {
+            ComponentTypeId id = countTrailingZero(mask);
+            mask &= mask - 1;
+            if (mComponents[id] != nullptr) {
+                function(mComponents[id]);
+            }
+        }
+    }
 }  // namespace GLaDOS
 
 #endif  //GLADOS_GAMEOBJECT_HPP
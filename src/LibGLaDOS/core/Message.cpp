@@ -5,23 +5,56 @@
 namespace GLaDOS {
     Message::Message(MessageType type) : mType(type) {}
 
-    Message::Message(MessageType type, void* data, std::size_t size) : mType(type) {
+    Message::Message(MessageType type, const void* data, std::size_t size) : mType(type) {
+        if (size <= inlineCapacity) {
+            // most payloads are a few values, keeping them inline saves an allocation per message
+            if (size != 0) {
+                std::memcpy(mInline, data, size);
+            }
+            mInlineSize = static_cast<uint32_t>(size);
+            return;
+        }
         mData.resize(size);
-        mData.copyFrom(reinterpret_cast<std::byte*>(data), size);
+        mData.copyFrom(static_cast<const std::byte*>(data), size);
+        mData.makeShared();
     }
 
+    Message::Message(MessageType type, const Blob& payload) : mType(type), mData(payload) {
+        mData.makeShared();
+    }
+
+    Message::Message(MessageType type, BlobView payload) : mType(type), mBorrowed(payload) {}
+
     Message::Message(const Message& rhs) {
         mType = rhs.mType;
+        mInlineSize = rhs.mInlineSize;
+        std::memcpy(mInline, rhs.mInline, rhs.mInlineSize);
         mData = rhs.mData;
+        mBorrowed = rhs.mBorrowed;
     }
 
     Message& Message::operator=(const Message& rhs) {
         mType = rhs.mType;
+        mInlineSize = rhs.mInlineSize;
+        std::memmove(mInline, rhs.mInline, rhs.mInlineSize);
         mData = rhs.mData;
+        mBorrowed = rhs.mBorrowed;
         return *this;
     }
 
     MessageType Message::type() const { return mType; }
 
-    void* Message::data() { return mData.pointer(); }
+    const void* Message::data() const {
+        return view().data();
+    }
+
+    BlobView Message::view() const {
+        if (mInlineSize != 0) {
+            return BlobView{mInline, mInlineSize};
+        }
+        if (!mBorrowed.isEmpty()) {
+            return mBorrowed;
+        }
+        return mData.view();
+    }
 }  // namespace GLaDOS
\ No newline at end of file
@@ -2,23 +2,35 @@
 #define GLADOS_MESSAGE_H
 
 #include "memory/Blob.h"
+#include "memory/BlobView.h"
 #include "utils/Enumeration.h"
 
 namespace GLaDOS {
     class Message {
       public:
+        static constexpr std::size_t inlineCapacity = 64;  // payloads up to this size are stored in the message
+
         explicit Message(MessageType type);
-        Message(MessageType type, void* data, std::size_t size);
+        Message(MessageType type, const void* data, std::size_t size);
+        Message(MessageType type, const Blob& payload);
+        // borrows the payload without copying, it must outlive the message
+        Message(MessageType type, BlobView payload);
 
+        // small payloads are copied, larger ones are shared between copies
         Message(const Message& rhs);
         Message& operator=(const Message& rhs);
 
         MessageType type() const;
-        void* data();
+        // payload is read only, receivers read it through view()
+        const void* data() const;
+        BlobView view() const;
 
       private:
         MessageType mType{MessageType::Undefined};
+        uint32_t mInlineSize{0};
+        alignas(std::max_align_t) std::byte mInline[inlineCapacity];
         Blob mData;
+        BlobView mBorrowed;
     };
 }  // namespace GLaDOS
 
@@ -0,0 +1,83 @@
+#include "MessageBus.hpp"
+
+#include <algorithm>
+
+namespace GLaDOS {
+    void MessageBus::post(GameObject* receiver, MessageType type) {
+        mQueue.push(receiver, type, nullptr, 0);
+    }
+
+    std::size_t MessageBus::dispatch() {
+        {
+            std::lock_guard<SpinLock> lock(mConcurrentLock);
+            for (const Envelope& envelope : mConcurrentQueue.envelopes) {
+                mQueue.push(envelope.receiver, envelope.type, mConcurrentQueue.payloads.data() + envelope.offset, envelope.size);
+            }
+            mConcurrentQueue.clear();
+        }
+        if (mQueue.envelopes.empty()) {
+            return 0;
+        }
+
+        // handlers may post again, those messages go to the fresh queue
+        std::swap(mQueue, mDispatching);
+        Vector<Envelope>& envelopes = mDispatching.envelopes;
+        std::stable_sort(envelopes.begin(), envelopes.end(), [](const Envelope& lhs, const Envelope& rhs) {
+            return lhs.receiver < rhs.receiver;
+        });
+
+        std::size_t delivered = 0;
+        std::size_t index = 0;
+        while (index < envelopes.size()) {
+            GameObject* receiver = envelopes[index].receiver;
+            std::size_t end = index;
+            while (end < envelopes.size() && envelopes[end].receiver == receiver) {
+                end++;
+            }
+            for (; index < end; index++) {
+                const Envelope& envelope = envelopes[index];
+                // a handler may destroy the receiver, handles are null for objects not created by a scene
+                if (receiver == nullptr || (!envelope.handle.isNull() && resolve(envelope.handle) != receiver)) {
+                    continue;
+                }
+                Message message{envelope.type, BlobView{mDispatching.payloads.data() + envelope.offset, envelope.size}};
+                // handlers may subscribe or remove components, so deliver to the subscribers at the start of the message
+                // and skip the ones that are gone by their turn
+                mDelivering.assign(receiver->mSubscriber[envelope.type].begin(), receiver->mSubscriber[envelope.type].end());
+                for (std::size_t i = 0; i < mDelivering.size(); i++) {
+                    if (i != 0 && !envelope.handle.isNull() && resolve(envelope.handle) != receiver) {
+                        break;
+                    }
+                    const Vector<Component*>& subscribers = receiver->mSubscriber[envelope.type];
+                    Component* component = mDelivering[i];
+                    if (i != 0 && std::find(subscribers.begin(), subscribers.end(), component) == subscribers.end()) {
+                        continue;
+                    }
+                    GameObject::deliverMessage(component, message);
+                }
+                delivered++;
+            }
+        }
+        mDispatching.clear();
+        return delivered;
+    }
+
+    std::size_t MessageBus::pendingCount() const {
+        return mQueue.envelopes.size() + mConcurrentQueue.envelopes.size();
+    }
+
+    void MessageBus::Queue::push(GameObject* receiver, MessageType type, const void* payload, std::size_t size) {
+        std::size_t offset = alignment(payloads.size(), payloadAlignment);
+        payloads.resize(offset + size);
+        if (size != 0) {
+            std::memcpy(payloads.data() + offset, payload, size);
+        }
+        Handle<GameObject> handle = receiver != nullptr ? receiver->handle() : Handle<GameObject>{};
+        envelopes.push_back({receiver, handle, type, static_cast<uint32_t>(offset), static_cast<uint32_t>(size)});
+    }
+
+    void MessageBus::Queue::clear() {
+        envelopes.clear();
+        payloads.clear();
+    }
+}  // namespace GLaDOS
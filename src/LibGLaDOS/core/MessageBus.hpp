@@ -0,0 +1,74 @@
+#ifndef GLADOS_MESSAGEBUS_HPP
+#define GLADOS_MESSAGEBUS_HPP
+
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+#include "GameObject.hpp"
+#include "utils/SpinLock.h"
+
+namespace GLaDOS {
+    // Scene level message queue. Messages posted during a frame are delivered together by dispatch(),
+    // grouped by receiver, to the components the receiver subscribed for the message type.
+    // Payloads are copied once into a per frame buffer and handed out as borrowed views.
+    class MessageBus {
+      public:
+        MessageBus() = default;
+        ~MessageBus() = default;
+
+        void post(GameObject* receiver, MessageType type);
+        template <typename T>
+        void post(GameObject* receiver, MessageType type, const T& payload);
+        // same as post, may be called from any thread
+        template <typename T>
+        void postConcurrent(GameObject* receiver, MessageType type, const T& payload);
+
+        // delivers the messages queued so far, messages posted by handlers wait for the next dispatch.
+        // messages of a receiver keep their posting order. returns the number of delivered messages
+        std::size_t dispatch();
+        std::size_t pendingCount() const;
+
+        DISALLOW_COPY_AND_ASSIGN(MessageBus);
+
+      private:
+        struct Envelope {
+            GameObject* receiver;
+            Handle<GameObject> handle;  // detects receivers destroyed before delivery
+            MessageType type;
+            uint32_t offset;
+            uint32_t size;
+        };
+
+        struct Queue {
+            void push(GameObject* receiver, MessageType type, const void* payload, std::size_t size);
+            void clear();
+
+            Vector<Envelope> envelopes;
+            Vector<std::byte> payloads;
+        };
+
+        static constexpr std::size_t payloadAlignment = alignof(std::max_align_t);
+
+        Queue mQueue;
+        Queue mConcurrentQueue;
+        SpinLock mConcurrentLock;
+        Queue mDispatching;
+        Vector<Component*> mDelivering;  // subscribers of the message being delivered
+    };
+
+    template <typename T>
+    void MessageBus::post(GameObject* receiver, MessageType type, const T& payload) {
+        static_assert(std::is_trivially_copyable_v<T>, "payload must be trivially copyable");
+        mQueue.push(receiver, type, &payload, sizeof(T));
+    }
+
+    template <typename T>
+    void MessageBus::postConcurrent(GameObject* receiver, MessageType type, const T& payload) {
+        static_assert(std::is_trivially_copyable_v<T>, "payload must be trivially copyable");
+        std::lock_guard<SpinLock> lock(mConcurrentLock);
+        mConcurrentQueue.push(receiver, type, &payload, sizeof(T));
+    }
+}  // namespace GLaDOS
+
+#endif  //GLADOS_MESSAGEBUS_HPP
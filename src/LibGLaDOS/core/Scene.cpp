@@ -1,12 +1,23 @@
 #include "Scene.h"
 
+#include <algorithm>
+
+#include "ComponentStore.hpp"
 #include "GameObject.hpp"
+#include "MessageBus.hpp"
+#include "TransformHierarchy.h"
 #include "core/component/Camera.h"
 #include "core/component/Transform.h"
+#include "core/spatial/SpatialIndex.h"
+#include "math/Math.h"
+#include "utils/FixedThreadPool.hpp"
 
 namespace GLaDOS {
     Logger* Scene::logger = LoggerRegistry::getInstance().makeAndGetLogger("Scene");
     Scene::Scene() {
+        mTransformHierarchy = NEW_T(TransformHierarchy);
+        mMessageBus = NEW_T(MessageBus);
+        mRegistry = NEW_T(SceneRegistry);
         // Every scene has at least a camera.
         GameObject* cameraObject = createGameObject("MainCamera");
         mMainCamera = cameraObject->addComponent<Camera>();
@@ -14,7 +25,19 @@ namespace GLaDOS {
 
     Scene::~Scene() {
         onDestroy();
-        deallocIterable(mGameObjects);
+        DELETE_T(mComponentStore, ComponentStore);
+        DELETE_T(mSpatialIndex, SpatialIndex);
+        DELETE_T(mTransformHierarchy, TransformHierarchy);
+        DELETE_T(mMessageBus, MessageBus);
+        DELETE_T(mRegistry, SceneRegistry);
+        for (GameObject* gameObject : mGameObjects) {
+            releaseGameObject(gameObject);
+        }
+        mGameObjects.clear();
+        mDestroyQueue.clear();
+        mAwakeObjects.clear();
+        mScheduleQueue.clear();
+        mWakeTimers.clear();
     }
 
     void Scene::addGameObject(GameObject* object) {
@@ -23,7 +46,14 @@ namespace GLaDOS {
             return;
         }
         object->mScene = this;
+        object->mSceneIndex = static_cast<uint32_t>(mGameObjects.size());
         mGameObjects.emplace_back(object);
+        if (mComponentStore != nullptr) {
+            mComponentStore->insert(object);
+        }
+        mTransformHierarchy->insert(object);
+        mRegistry->insert(object);
+        scheduleObject(object);
     }
 
     uint32_t Scene::getBuildIndex() const {
@@ -35,34 +65,125 @@ namespace GLaDOS {
     }
 
     GameObject* Scene::createGameObject(std::string name) {
-        return NEW_T(GameObject(name, this));
+        HandlePool<GameObject>& pool = HandlePool<GameObject>::getInstance();
+        GameObject* gameObject = pool.create(name, this);
+        if (gameObject != nullptr) {
+            gameObject->mHandle = pool.handleOf(gameObject);
+        }
+        return gameObject;
     }
 
     GameObject* Scene::createGameObject(std::string name, GameObject* parent) {
-        return NEW_T(GameObject(name, parent, this));
+        HandlePool<GameObject>& pool = HandlePool<GameObject>::getInstance();
+        GameObject* gameObject = pool.create(name, parent, this);
+        if (gameObject != nullptr) {
+            gameObject->mHandle = pool.handleOf(gameObject);
+        }
+        return gameObject;
     }
 
     bool Scene::destroy(GameObject* gameObject) {
-        if (gameObject == nullptr) {
+        if (!contains(gameObject)) {
+            LOG_INFO(logger, "No GameObject found to destroy.");
             return false;
         }
+        if (gameObject->mPendingDestroy) {
+            return true;
+        }
 
-        Vector<GameObject*>::iterator iter = std::find_if(mGameObjects.begin(), mGameObjects.end(), [gameObject](GameObject* object) {
-            return object->getInstanceId() == gameObject->getInstanceId();
-        });
+        // children are collected when the queue is flushed, they may change until then
+        gameObject->mPendingDestroy = true;
+        gameObject->mDestroyQueueIndex = static_cast<uint32_t>(mDestroyQueue.size());
+        mDestroyQueue.push_back(gameObject);
+        return true;
+    }
 
-        if (iter == mGameObjects.end()) {
-            LOG_INFO(logger, "No GameObject name: `{0}`, instanceId: {1} found.", gameObject->getName(), gameObject->getInstanceId());
+    bool Scene::destroyImmediate(GameObject* gameObject) {
+        if (!contains(gameObject)) {
+            LOG_INFO(logger, "No GameObject found to destroy.");
             return false;
         }
 
-        mGameObjects.erase(iter);
-        (*iter)->onDestroy();
-        DELETE_T((*iter), GameObject);
+        // children go first, they unlink themselves from this object
+        while (!gameObject->mChildren.empty()) {
+            GameObject* child = gameObject->mChildren.back();
+            if (!destroyImmediate(child)) {
+                child->mParent = nullptr;
+                gameObject->mChildren.pop_back();
+            }
+        }
+        if (gameObject->mParent != nullptr) {
+            gameObject->mParent->removeChildren(gameObject);
+        }
+        if (gameObject->mPendingDestroy) {
+            mDestroyQueue[gameObject->mDestroyQueueIndex] = nullptr;
+        }
+
+        // swap and pop
+        GameObject* last = mGameObjects.back();
+        mGameObjects[gameObject->mSceneIndex] = last;
+        last->mSceneIndex = gameObject->mSceneIndex;
+        mGameObjects.pop_back();
+
+        if (mComponentStore != nullptr) {
+            mComponentStore->remove(gameObject);
+        }
+        if (gameObject->mAwakeSlot != GameObject::unregistered) {
+            GameObject* lastAwake = mAwakeObjects.back();
+            mAwakeObjects[gameObject->mAwakeSlot] = lastAwake;
+            lastAwake->mAwakeSlot = gameObject->mAwakeSlot;
+            mAwakeObjects.pop_back();
+            gameObject->mAwakeSlot = GameObject::unregistered;
+        }
+        if (gameObject->mScheduleQueued) {
+            mScheduleQueue.erase(std::find(mScheduleQueue.begin(), mScheduleQueue.end(), gameObject));
+        }
+        gameObject->forEachComponent([this](Component* component) {
+            cancelWakeTimers(component);
+        });
+        mTransformHierarchy->remove(gameObject);
+        mRegistry->remove(gameObject);
+        if (mSpatialIndex != nullptr) {
+            mSpatialIndex->remove(gameObject);
+        }
+        gameObject->onDestroy();
+        releaseGameObject(gameObject);
 
         return true;
     }
 
+    void Scene::flushDestroyQueue() {
+        // onDestroy may destroy more objects, they are flushed in the same pass
+        for (std::size_t index = 0; index < mDestroyQueue.size(); index++) {
+            if (mDestroyQueue[index] != nullptr) {
+                destroyImmediate(mDestroyQueue[index]);
+            }
+        }
+        mDestroyQueue.clear();
+    }
+
+    bool Scene::contains(const GameObject* gameObject) const {
+        return gameObject != nullptr && gameObject->mScene == this && gameObject->mSceneIndex < mGameObjects.size() &&
+               mGameObjects[gameObject->mSceneIndex] == gameObject;
+    }
+
+    std::size_t Scene::gameObjectCount() const {
+        return mGameObjects.size();
+    }
+
+    std::size_t Scene::awakeObjectCount() const {
+        return mAwakeObjects.size();
+    }
+
+    void Scene::releaseGameObject(GameObject* gameObject) {
+        // handles of the object go stale here
+        if (!gameObject->mHandle.isNull()) {
+            HandlePool<GameObject>::getInstance().destroy(gameObject);
+            return;
+        }
+        DELETE_T(gameObject, GameObject);
+    }
+
     GameObject* Scene::instantiate(GameObject* original) {
         return original->clone();
     }
@@ -80,9 +201,233 @@ namespace GLaDOS {
         return newGameObject;
     }
 
+    Vector<GameObject*> Scene::instantiateMany(GameObject* original, std::size_t count, const Mat4<real>* transforms) {
+        Vector<GameObject*> clones;
+        if (original == nullptr || count == 0) {
+            return clones;
+        }
+        if (original->mScene != this) {
+            LOG_ERROR(logger, "GameObject `{0}` belongs to another scene.", original->getName());
+            return clones;
+        }
+
+        std::size_t subtreeSize = 0;
+        std::size_t componentCounts[maxComponentTypes] = {};
+        const ComponentPool* componentPools[maxComponentTypes] = {};
+        Vector<GameObject*> pending{original};
+        while (!pending.empty()) {
+            GameObject* gameObject = pending.back();
+            pending.pop_back();
+            subtreeSize++;
+            for (ComponentMask mask = gameObject->mComponentMask; mask != 0; mask &= mask - 1) {
+                ComponentTypeId id = countTrailingZero(mask);
+                componentCounts[id]++;
+                componentPools[id] = gameObject->mComponents[id]->mPool;
+            }
+            pending.insert(pending.end(), gameObject->mChildren.begin(), gameObject->mChildren.end());
+        }
+        std::size_t total = subtreeSize * count;
+        HandlePool<GameObject>& pool = HandlePool<GameObject>::getInstance();
+        if (!pool.reserve(pool.size() + total)) {
+            LOG_ERROR(logger, "Failed to reserve {0} GameObjects.", total);
+            return clones;
+        }
+        // clones made with Component::newComponent land in the pool of the original
+        for (std::size_t id = 0; id < maxComponentTypes; id++) {
+            if (componentPools[id] != nullptr && !componentPools[id]->reserve(componentCounts[id] * count)) {
+                LOG_ERROR(logger, "Failed to reserve {0} components.", componentCounts[id] * count);
+                return clones;
+            }
+        }
+        mGameObjects.reserve(mGameObjects.size() + total);
+        clones.reserve(count);
+
+        for (std::size_t i = 0; i < count; i++) {
+            GameObject* clone = original->clone();
+            if (clone == nullptr) {
+                break;
+            }
+            if (transforms != nullptr) {
+                clone->transform()->decomposeSRT(transforms[i]);
+            }
+            clones.emplace_back(clone);
+        }
+        return clones;
+    }
+
+    void Scene::enableComponentStore() {
+        if (mComponentStore != nullptr) {
+            return;
+        }
+        mComponentStore = NEW_T(ComponentStore);
+        for (GameObject* gameObject : mGameObjects) {
+            mComponentStore->insert(gameObject);
+        }
+    }
+
+    ComponentStore* Scene::componentStore() const {
+        return mComponentStore;
+    }
+
+    TransformHierarchy* Scene::transformHierarchy() const {
+        return mTransformHierarchy;
+    }
+
+    void Scene::setUpdateThreadPool(FixedThreadPool* threadPool, std::size_t chunkSize) {
+        mUpdateThreadPool = threadPool;
+        mUpdateChunkSize = chunkSize != 0 ? chunkSize : defaultUpdateChunkSize;
+    }
+
+    FixedThreadPool* Scene::updateThreadPool() const {
+        return mUpdateThreadPool;
+    }
+
+    void Scene::addActivationStep(std::function<void()> step) {
+        mActivationSteps.emplace_back(std::move(step));
+    }
+
+    void Scene::reportLoadProgress(real progress) {
+        mLoadProgress.store(Math::clamp(progress, real(0), real(1)), std::memory_order_relaxed);
+    }
+
+    MessageBus* Scene::messageBus() const {
+        return mMessageBus;
+    }
+
+    void Scene::setSpatialIndex(SpatialIndex* index) {
+        if (mSpatialIndex == index) {
+            return;
+        }
+        DELETE_T(mSpatialIndex, SpatialIndex);
+        mSpatialIndex = index;
+        // off and on again, so every object goes into the new index
+        mTransformHierarchy->setTrackMoves(false);
+        mTransformHierarchy->setTrackMoves(mSpatialIndex != nullptr);
+    }
+
+    SceneRegistry* Scene::registry() const {
+        return mRegistry;
+    }
+
+    SpatialIndex* Scene::spatialIndex() const {
+        return mSpatialIndex;
+    }
+
+    void Scene::syncSpatialIndex() {
+        if (mSpatialIndex == nullptr) {
+            return;
+        }
+        mTransformHierarchy->takeMovedTransforms(mMovedTransforms);
+        for (Transform* transform : mMovedTransforms) {
+            mSpatialIndex->update(transform->gameObject(), Mat4<real>::decomposeTranslation(transform->localToWorldMatrix()));
+        }
+        mMovedTransforms.clear();
+    }
+
+    std::size_t Scene::queryRadius(const Vec3& center, real radius, GameObject** result, std::size_t capacity) {
+        if (mSpatialIndex == nullptr) {
+            LOG_ERROR(logger, "Scene `{0}` has no spatial index.", mName);
+            return 0;
+        }
+        syncSpatialIndex();
+        return mSpatialIndex->queryRadius(center, radius, result, capacity);
+    }
+
+    std::size_t Scene::queryAABB(const Vec3& min, const Vec3& max, GameObject** result, std::size_t capacity) {
+        if (mSpatialIndex == nullptr) {
+            LOG_ERROR(logger, "Scene `{0}` has no spatial index.", mName);
+            return 0;
+        }
+        syncSpatialIndex();
+        return mSpatialIndex->queryAABB(min, max, result, capacity);
+    }
+
+    std::size_t Scene::queryNearest(const Vec3& point, std::size_t k, GameObject** result, real* distances) {
+        if (mSpatialIndex == nullptr) {
+            LOG_ERROR(logger, "Scene `{0}` has no spatial index.", mName);
+            return 0;
+        }
+        syncSpatialIndex();
+        return mSpatialIndex->queryNearest(point, k, result, distances);
+    }
+
+    void Scene::scheduleObject(GameObject* gameObject) {
+        std::lock_guard<std::mutex> lock{mScheduleMutex};
+        if (!gameObject->mScheduleQueued) {
+            gameObject->mScheduleQueued = true;
+            mScheduleQueue.push_back(gameObject);
+        }
+    }
+
+    void Scene::applySchedule() {
+        wakeDueComponents();
+        for (GameObject* gameObject : mScheduleQueue) {
+            gameObject->mScheduleQueued = false;
+            bool awake = gameObject->isAwake();
+            if (awake && gameObject->mAwakeSlot == GameObject::unregistered) {
+                gameObject->mAwakeSlot = static_cast<uint32_t>(mAwakeObjects.size());
+                mAwakeObjects.push_back(gameObject);
+            } else if (!awake && gameObject->mAwakeSlot != GameObject::unregistered) {
+                GameObject* last = mAwakeObjects.back();
+                mAwakeObjects[gameObject->mAwakeSlot] = last;
+                last->mAwakeSlot = gameObject->mAwakeSlot;
+                mAwakeObjects.pop_back();
+                gameObject->mAwakeSlot = GameObject::unregistered;
+            }
+            if (mComponentStore != nullptr) {
+                mComponentStore->refreshSleep(gameObject);
+            }
+        }
+        mScheduleQueue.clear();
+    }
+
+    bool Scene::wakesLater(const WakeTimer& a, const WakeTimer& b) {
+        return a.time > b.time;
+    }
+
+    void Scene::addWakeTimer(Component* component, real seconds) {
+        std::lock_guard<std::mutex> lock{mScheduleMutex};
+        mWakeTimers.push_back(WakeTimer{mTime + seconds, component, component->mSleepSerial});
+        std::push_heap(mWakeTimers.begin(), mWakeTimers.end(), wakesLater);
+        component->mWakeTimerCount++;
+    }
+
+    void Scene::cancelWakeTimers(Component* component) {
+        if (component->mWakeTimerCount == 0) {
+            return;
+        }
+        mWakeTimers.erase(std::remove_if(mWakeTimers.begin(), mWakeTimers.end(), [component](const WakeTimer& timer) {
+            return timer.component == component;
+        }), mWakeTimers.end());
+        std::make_heap(mWakeTimers.begin(), mWakeTimers.end(), wakesLater);
+        component->mWakeTimerCount = 0;
+    }
+
+    void Scene::wakeDueComponents() {
+        while (!mWakeTimers.empty() && mWakeTimers.front().time <= mTime) {
+            std::pop_heap(mWakeTimers.begin(), mWakeTimers.end(), wakesLater);
+            WakeTimer timer = mWakeTimers.back();
+            mWakeTimers.pop_back();
+            timer.component->mWakeTimerCount--;
+            // a timer of an earlier sleep must not cut a later one short
+            if (timer.component->mSleepSerial == timer.sleepSerial) {
+                timer.component->wake();
+            }
+        }
+    }
+
     void Scene::fixedUpdate(real fixedDeltaTime) {
         onFixedUpdate(fixedDeltaTime);
-        for (auto& gameObject : mGameObjects) {
+        applySchedule();
+        if (mUpdateThreadPool != nullptr) {
+            fixedUpdateInPhases(fixedDeltaTime);
+            return;
+        }
+        if (mComponentStore != nullptr) {
+            mComponentStore->fixedUpdate(fixedDeltaTime);
+            return;
+        }
+        for (auto& gameObject : mAwakeObjects) {
             if (gameObject->isActive()) {
                 gameObject->fixedUpdate(fixedDeltaTime);
             }
@@ -91,21 +436,97 @@ namespace GLaDOS {
 
     void Scene::update(real deltaTime) {
         onUpdate(deltaTime);
-        for (auto& gameObject : mGameObjects) {
-            if (gameObject->isActive()) {
-                gameObject->update(deltaTime);
+        mMessageBus->dispatch();
+        mTransformHierarchy->update(mGameObjects);
+        // after messages and transform changes had their chance to wake components
+        mTime += deltaTime;
+        applySchedule();
+        if (mUpdateThreadPool != nullptr) {
+            updateInPhases(deltaTime);
+        } else if (mComponentStore != nullptr) {
+            mComponentStore->update(deltaTime);
+        } else {
+            for (auto& gameObject : mAwakeObjects) {
+                if (gameObject->isActive()) {
+                    gameObject->update(deltaTime);
+                }
             }
         }
         onLateUpdate(deltaTime);
     }
 
+    void Scene::fixedUpdateInPhases(real fixedDeltaTime) {
+        for (int i = 0; i < static_cast<int>(UpdatePhase::TheNumberOfPhase); i++) {
+            UpdatePhase phase = static_cast<UpdatePhase>(i);
+            mDeferTransformChanges = true;
+            mUpdateThreadPool->parallelFor(mAwakeObjects.size(), mUpdateChunkSize, [this, fixedDeltaTime, phase](std::size_t begin, std::size_t end) {
+                for (std::size_t index = begin; index < end; index++) {
+                    if (mAwakeObjects[index]->isActive()) {
+                        mAwakeObjects[index]->fixedUpdate(fixedDeltaTime, phase, true);
+                    }
+                }
+            });
+            mDeferTransformChanges = false;
+            applyDeferredTransformChanges();
+            for (std::size_t index = 0; index < mAwakeObjects.size(); index++) {
+                if (mAwakeObjects[index]->isActive()) {
+                    mAwakeObjects[index]->fixedUpdate(fixedDeltaTime, phase, false);
+                }
+            }
+        }
+    }
+
+    void Scene::updateInPhases(real deltaTime) {
+        for (int i = 0; i < static_cast<int>(UpdatePhase::TheNumberOfPhase); i++) {
+            UpdatePhase phase = static_cast<UpdatePhase>(i);
+            if (phase == UpdatePhase::RendererPrep) {
+                // animation has posed the transforms, renderers read the final world matrices
+                mTransformHierarchy->update(mGameObjects);
+            }
+            mDeferTransformChanges = true;
+            mUpdateThreadPool->parallelFor(mAwakeObjects.size(), mUpdateChunkSize, [this, deltaTime, phase](std::size_t begin, std::size_t end) {
+                for (std::size_t index = begin; index < end; index++) {
+                    if (mAwakeObjects[index]->isActive()) {
+                        mAwakeObjects[index]->update(deltaTime, phase, true);
+                    }
+                }
+            });
+            mDeferTransformChanges = false;
+            applyDeferredTransformChanges();
+            for (std::size_t index = 0; index < mAwakeObjects.size(); index++) {
+                if (mAwakeObjects[index]->isActive()) {
+                    mAwakeObjects[index]->update(deltaTime, phase, false);
+                }
+            }
+        }
+    }
+
+    bool Scene::deferTransformChange(Transform* transform) {
+        if (!mDeferTransformChanges) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock{mDeferredMutex};
+        mDeferredTransforms.push_back(transform);
+        return true;
+    }
+
+    void Scene::applyDeferredTransformChanges() {
+        // workers have joined, no lock needed
+        for (Transform* transform : mDeferredTransforms) {
+            transform->dirty();
+        }
+        mDeferredTransforms.clear();
+    }
+
     void Scene::render() {
         onPreRender();
+        mTransformHierarchy->update(mGameObjects);
         for (auto& gameObject : mGameObjects) {
             if (gameObject->isActive()) {
                 gameObject->render();
             }
         }
         onPostRender();
+        flushDestroyQueue();
     }
 }  // namespace GLaDOS
\ No newline at end of file
@@ -1,9 +1,14 @@
 #ifndef GLADOS_SCENE_H
 #define GLADOS_SCENE_H
 
+#include <atomic>
 #include <cstdint>
+#include <functional>
+#include <mutex>
 
 #include "Object.h"
+#include "SceneRegistry.h"
+#include "memory/FrameArena.h"
 
 namespace GLaDOS {
     class Logger;
@@ -12,8 +17,22 @@ namespace GLaDOS {
     class Camera;
     class Vec3;
     class Quat;
+    template <typename T>
+    class Mat4;
+    class ComponentStore;
+    class TransformHierarchy;
+    class FixedThreadPool;
+    class MessageBus;
+    class SceneLoadOperation;
+    class SpatialIndex;
+    class Transform;
     class Scene : public Object {
         friend class SceneManager;
+        friend class SceneLoadOperation;
+        friend class SceneSnapshot;
+        friend class GameObject;
+        friend class Component;
+        friend class Transform;
 
       public:
         Scene();
@@ -23,6 +42,10 @@ namespace GLaDOS {
         uint32_t getBuildIndex() const;
         Camera* getMainCamera();
 
+        // Only at once being called before onInit. Runs on the loader thread when the scene is loaded by
+        // SceneManager::loadSceneAsync, so read and decode resources here, but create game objects and
+        // GPU objects in onInit or in activation steps which run on the main thread.
+        virtual bool onLoad() { return true; }
         // Only at once being called when scene object is created
         virtual bool onInit() { return true; }
         // being called whenever scene is activated
@@ -39,10 +62,67 @@ namespace GLaDOS {
         GameObject* createGameObject(std::string name);
         GameObject* createGameObject(std::string name, GameObject* parent);
 
+        // destroys the object and its children at the end of the frame, safe to call while updating
         bool destroy(GameObject* gameObject);
+        // destroys the object and its children now, must not be called while the scene iterates objects
+        bool destroyImmediate(GameObject* gameObject);
+        // applies pending destroys, called by render() at the end of the frame
+        void flushDestroyQueue();
+        bool contains(const GameObject* gameObject) const;
+        std::size_t gameObjectCount() const;
+        // objects with a component that is not sleeping, the ones update visits. see Component::sleep
+        std::size_t awakeObjectCount() const;
         GameObject* instantiate(GameObject* original);
         GameObject* instantiate(GameObject* original, const Vec3& position);
         GameObject* instantiate(GameObject* original, const Vec3& position, const Quat& rotation);
+        // Clones `original` and its children `count` times with storage for all of them allocated up front.
+        // `transforms` holds a local matrix per clone (relative to the parent of original), nullptr keeps the
+        // transform of original. Renderers of the clones share the mesh and material of the original.
+        Vector<GameObject*> instantiateMany(GameObject* original, std::size_t count, const Mat4<real>* transforms = nullptr);
+
+        // Groups objects by component set so systems iterate components linearly, and updates
+        // components type by type. Off by default, can't be turned off once enabled.
+        void enableComponentStore();
+        ComponentStore* componentStore() const;  // nullptr unless enabled
+        // world matrices of dirty transforms are recomputed here once before update and render
+        TransformHierarchy* transformHierarchy() const;
+
+        // Updates objects phase by phase (see UpdatePhase). In every phase the thread safe components run on
+        // `threadPool` in chunks of objects, then the others run on the main thread. Objects must not be created
+        // or destroyed from a worker. nullptr goes back to the serial update. The pool is not owned by the scene.
+        void setUpdateThreadPool(FixedThreadPool* threadPool, std::size_t chunkSize = defaultUpdateChunkSize);
+        FixedThreadPool* updateThreadPool() const;
+        // Called from onLoad or onInit. Steps run in order on the main thread before the scene is added to the
+        // SceneManager, a few per frame for a scene loaded asynchronously (see SceneManager::setActivationBudget).
+        void addActivationStep(std::function<void()> step);
+        // Called from onLoad, 0 to 1. See SceneLoadOperation::progress()
+        void reportLoadProgress(real progress);
+        // messages posted here are delivered at the start of the next update
+        MessageBus* messageBus() const;
+
+        // Every component of type T in the scene, inactive ones included, read from the dense array of the type.
+        // The copy lives in FrameArena and is valid until the end of the next frame.
+        template <typename T>
+        FrameVector<T*> findObjectsOfType() const;
+        // function(T*) for every component of type T, components of T must not be added or removed meanwhile
+        template <typename T, typename Function>
+        void forEachObjectOfType(Function&& function) const;
+        // function(GameObject*) for every object in `layer`, objects must not change layer meanwhile
+        template <typename Function>
+        void forEachInLayer(uint32_t layer, Function&& function) const;
+        SceneRegistry* registry() const;
+
+        // Indexes the world positions of the game objects, e.g. NEW_T(SpatialHash)(cellSize) or a LooseOctree.
+        // The index is owned by the scene, nullptr removes it. Off by default.
+        void setSpatialIndex(SpatialIndex* index);
+        SpatialIndex* spatialIndex() const;
+        // moves the objects whose transform changed since the last sync, queries call it first
+        void syncSpatialIndex();
+        // Proximity queries from the main thread, they write into the caller's buffers and return the number written.
+        // Workers call syncSpatialIndex() beforehand on the main thread and query spatialIndex() directly.
+        std::size_t queryRadius(const Vec3& center, real radius, GameObject** result, std::size_t capacity);
+        std::size_t queryAABB(const Vec3& min, const Vec3& max, GameObject** result, std::size_t capacity);
+        std::size_t queryNearest(const Vec3& point, std::size_t k, GameObject** result, real* distances);
 
       protected:
         void fixedUpdate(real fixedDeltaTime) override;
@@ -51,11 +131,88 @@ namespace GLaDOS {
 
       private:
         static Logger* logger;
+        static constexpr std::size_t defaultUpdateChunkSize = 128;
+
+        static void releaseGameObject(GameObject* gameObject);
+        void fixedUpdateInPhases(real fixedDeltaTime);
+        void updateInPhases(real deltaTime);
+        // sleep state changes may come from workers, the awake objects are updated before the next update
+        void scheduleObject(GameObject* gameObject);
+        void applySchedule();
+        void addWakeTimer(Component* component, real seconds);
+        void cancelWakeTimers(Component* component);
+        void wakeDueComponents();
+        // Transform changes made by thread safe components are queued while their phase runs and applied on the
+        // main thread afterwards, so dirty flags of children and wakeups are never written from workers.
+        bool deferTransformChange(Transform* transform);
+        void applyDeferredTransformChanges();
+
+        struct WakeTimer {
+            real time;
+            Component* component;
+            uint32_t sleepSerial;
+        };
+        static bool wakesLater(const WakeTimer& a, const WakeTimer& b);
 
         uint32_t mBuildIndex{0};
-        Vector<GameObject*> mGameObjects;
+        Vector<GameObject*> mGameObjects;  // unordered, removal swaps the last object in
+        Vector<GameObject*> mDestroyQueue;  // nullptr for an object destroyed before the flush
+        Vector<GameObject*> mAwakeObjects;  // unordered, removal swaps the last object in
+        Vector<GameObject*> mScheduleQueue;
+        Vector<WakeTimer> mWakeTimers;  // min heap on time
+        std::mutex mScheduleMutex;  // guards mScheduleQueue and mWakeTimers while workers update
+        Vector<Transform*> mDeferredTransforms;
+        std::mutex mDeferredMutex;  // guards mDeferredTransforms while workers update
+        bool mDeferTransformChanges{false};  // set while thread safe components run
+        real mTime{0};  // sum of update delta times, wake timers count in it
         Camera* mMainCamera;
+        ComponentStore* mComponentStore{nullptr};
+        TransformHierarchy* mTransformHierarchy{nullptr};
+        FixedThreadPool* mUpdateThreadPool{nullptr};
+        MessageBus* mMessageBus{nullptr};
+        SceneRegistry* mRegistry{nullptr};
+        SpatialIndex* mSpatialIndex{nullptr};
+        Vector<Transform*> mMovedTransforms;  // reused by syncSpatialIndex
+        std::size_t mUpdateChunkSize{defaultUpdateChunkSize};
+        Vector<std::function<void()>> mActivationSteps;
+        std::atomic<real> mLoadProgress{0};
     };
+
+    template <typename T>
+    FrameVector<T*> Scene::findObjectsOfType() const {
+        FrameVector<T*> objects;
+        ComponentTypeId id = componentTypeId<T>();
+        if (id >= maxComponentTypes) {
+            return objects;
+        }
+        const Vector<Component*>& components = mRegistry->componentsOf(id);
+        objects.reserve(components.size());
+        for (Component* component : components) {
+            objects.push_back(static_cast<T*>(component));
+        }
+        return objects;
+    }
+
+    template <typename T, typename Function>
+    void Scene::forEachObjectOfType(Function&& function) const {
+        ComponentTypeId id = componentTypeId<T>();
+        if (id >= maxComponentTypes) {
+            return;
+        }
+        for (Component* component : mRegistry->componentsOf(id)) {
+            function(static_cast<T*>(component));
+        }
+    }
+
+    template <typename Function>
+    void Scene::forEachInLayer(uint32_t layer, Function&& function) const {
+        if (layer >= SceneRegistry::maxLayers) {
+            return;
+        }
+        for (GameObject* gameObject : mRegistry->objectsIn(layer)) {
+            function(gameObject);
+        }
+    }
 }  // namespace GLaDOS
 
 #endif  //GLADOS_SCENE_H
@@ -1,14 +1,61 @@
 #include "SceneManager.h"
 
 #include "Scene.h"
+#include "memory/FrameArena.h"
+#include "platform/Timer.h"
+#include "utils/FixedThreadPool.hpp"
 
 namespace GLaDOS {
+    SceneLoadState SceneLoadOperation::state() const {
+        return mState;
+    }
+
+    bool SceneLoadOperation::isDone() const {
+        SceneLoadState current = state();
+        return current == SceneLoadState::Done || current == SceneLoadState::Failed;
+    }
+
+    real SceneLoadOperation::progress() const {
+        switch (state()) {
+            case SceneLoadState::Loading:
+                return real(0.5) * mScene->mLoadProgress.load(std::memory_order_relaxed);
+            case SceneLoadState::Activating: {
+                // onInit counts as a step
+                std::size_t stepCount = mScene->mActivationSteps.size() + 1;
+                std::size_t doneCount = mNextStep + (mInitialized ? 1 : 0);
+                return real(0.5) + real(0.5) * static_cast<real>(doneCount) / static_cast<real>(stepCount);
+            }
+            case SceneLoadState::Done:
+                return real(1);
+            default:
+                return real(0);
+        }
+    }
+
+    Scene* SceneLoadOperation::scene() const {
+        return state() == SceneLoadState::Done ? mScene : nullptr;
+    }
+
+    const std::string& SceneLoadOperation::sceneName() const {
+        return mSceneName;
+    }
+
+    void SceneLoadOperation::setActivateOnLoad(bool activate) {
+        mActivateOnLoad = activate;
+    }
+
     Logger* SceneManager::logger = LoggerRegistry::getInstance().makeAndGetLogger("SceneManager");
     SceneManager::SceneManager() {
         setDestructionPhase(3);
     }
 
     SceneManager::~SceneManager() {
+        // waits for the running onLoad
+        DELETE_T(mLoadThreadPool, FixedThreadPool);
+        for (RefPtr<SceneLoadOperation>& operation : mLoadOperations) {
+            DELETE_T(operation->mScene, Scene);
+        }
+        mLoadOperations.clear();
         mCurrentScene = nullptr;
         deallocValueInMap(mScenes);
     }
@@ -64,6 +111,18 @@ namespace GLaDOS {
         return mScenes.size();
     }
 
+    void SceneManager::setActivationBudget(real seconds) {
+        mActivationBudget = std::max(seconds, real(0));
+    }
+
+    real SceneManager::activationBudget() const {
+        return mActivationBudget;
+    }
+
+    std::size_t SceneManager::loadingSceneCount() const {
+        return mLoadOperations.size();
+    }
+
     bool SceneManager::isValidScene() const {
         return (mCurrentScene != nullptr) && mCurrentScene->isActive();
     }
@@ -75,6 +134,7 @@ namespace GLaDOS {
     }
 
     void SceneManager::update(real deltaTime) {
+        activateLoadedScenes();
         if (isValidScene()) {
             mCurrentScene->update(deltaTime);
         }
@@ -84,5 +144,101 @@ namespace GLaDOS {
         if (isValidScene()) {
             mCurrentScene->render();
         }
+        // frame temporaries allocated during this frame are released at the end of next frame
+        FrameArena::getInstance().swapBuffers();
+    }
+
+    bool SceneManager::isNameTaken(const std::string& name) const {
+        if (sceneByName(name) != nullptr) {
+            return true;
+        }
+        for (const RefPtr<SceneLoadOperation>& operation : mLoadOperations) {
+            if (operation->sceneName() == name) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void SceneManager::addScene(Scene* scene) {
+        scene->mBuildIndex = mLastSceneCount;
+        mScenes.try_emplace(mLastSceneCount, scene);
+        mLastSceneCount++;
+    }
+
+    RefPtr<SceneLoadOperation> SceneManager::startLoad(Scene* scene, const std::string& name) {
+        if (mLoadThreadPool == nullptr) {
+            // scenes load one after another, onLoad may spread its own work over a pool
+            mLoadThreadPool = NEW_T(FixedThreadPool)(1);
+        }
+        RefPtr<SceneLoadOperation> operation = NEW_T(SceneLoadOperation);
+        operation->mScene = scene;
+        operation->mSceneName = name;
+        mLoadOperations.emplace_back(operation);
+
+        mLoadThreadPool->pushTask([operation]() {
+            operation->mLoadSucceeded = operation->mScene->onLoad();
+            operation->mLoaded.store(true, std::memory_order_release);
+        });
+        return operation;
+    }
+
+    void SceneManager::activateLoadedScenes() {
+        if (mLoadOperations.empty()) {
+            return;
+        }
+
+        HighResolutionTimePoint start = Timer::now();
+        bool stepped = false;
+        auto hasTimeLeft = [this, &start, &stepped]() {
+            return !stepped || Timer::getInterval(start, Timer::now()) < mActivationBudget;
+        };
+
+        // operations finish in the order they were started
+        while (!mLoadOperations.empty() && hasTimeLeft()) {
+            SceneLoadOperation* operation = mLoadOperations.front().get();
+            Scene* scene = operation->mScene;
+            if (!operation->mLoaded.load(std::memory_order_acquire)) {
+                return;
+            }
+            SceneLoadState state = operation->mLoadSucceeded ? SceneLoadState::Activating : SceneLoadState::Failed;
+
+            operation->mState = state;
+            if (state == SceneLoadState::Activating && !operation->mInitialized) {
+                operation->mInitialized = true;
+                stepped = true;
+                if (!scene->onInit()) {
+                    state = SceneLoadState::Failed;
+                }
+            }
+
+            if (state == SceneLoadState::Activating) {
+                Vector<std::function<void()>>& steps = scene->mActivationSteps;
+                while (operation->mNextStep < steps.size() && hasTimeLeft()) {
+                    // steps may add steps
+                    std::function<void()> step = std::move(steps[operation->mNextStep]);
+                    step();
+                    operation->mNextStep++;
+                    stepped = true;
+                }
+                if (operation->mNextStep < steps.size()) {
+                    return;
+                }
+                steps.clear();
+                addScene(scene);
+                LOG_TRACE(logger, "Scene `{0}` loaded with buildIndex {1}.", scene->getName(), scene->getBuildIndex());
+                operation->mState = SceneLoadState::Done;
+                if (operation->mActivateOnLoad) {
+                    setActiveScene(scene);
+                }
+            } else {
+                // onInit only runs after a successful onLoad
+                LOG_ERROR(logger, "Failed to {0} in scene `{1}`", operation->mLoadSucceeded ? "onInit" : "onLoad", scene->getName());
+                operation->mState = SceneLoadState::Failed;
+                operation->mScene = nullptr;
+                DELETE_T(scene, Scene);
+            }
+            mLoadOperations.erase(mLoadOperations.begin());
+        }
     }
 }  // namespace GLaDOS
\ No newline at end of file
@@ -1,13 +1,48 @@
 #ifndef GLADOS_SCENEMANAGER_H
 #define GLADOS_SCENEMANAGER_H
 
+#include <atomic>
+#include <functional>
+
 #include "utils/Enumeration.h"
+#include "utils/RefCounted.h"
+#include "utils/RefPtr.hpp"
 #include "utils/Singleton.hpp"
 #include "utils/Utility.h"
 
 namespace GLaDOS {
     class Logger;
     class Scene;
+    class FixedThreadPool;
+    // Progress of a scene loaded by SceneManager::loadSceneAsync, read it from the main thread.
+    class SceneLoadOperation : public RefCounted {
+        friend class SceneManager;
+
+      public:
+        SceneLoadOperation() = default;
+
+        SceneLoadState state() const;
+        bool isDone() const;  // Done or Failed
+        // 0 to 1, onLoad accounts for the first half and the activation for the second half
+        real progress() const;
+        Scene* scene() const;  // nullptr until Done
+        const std::string& sceneName() const;
+        // the scene becomes the active scene when it is done, true by default
+        void setActivateOnLoad(bool activate);
+
+        DISALLOW_COPY_AND_ASSIGN(SceneLoadOperation);
+
+      private:
+        Scene* mScene{nullptr};
+        std::string mSceneName;
+        SceneLoadState mState{SceneLoadState::Loading};  // changed by the main thread only
+        std::atomic<bool> mLoaded{false};  // onLoad returned, the loader thread publishes mLoadSucceeded
+        bool mLoadSucceeded{false};
+        bool mActivateOnLoad{true};
+        bool mInitialized{false};  // onInit called
+        std::size_t mNextStep{0};
+    };
+
     class SceneManager : public Singleton<SceneManager> {
       public:
         SceneManager();
@@ -15,6 +50,11 @@ namespace GLaDOS {
 
         template <typename T>
         Scene* createScene(const std::string& name);
+        // Constructs the scene and runs its onLoad on the loader thread. update() then calls onInit and the
+        // activation steps within the activation budget of every frame, and adds the scene once they are done.
+        // Returns null if the name is taken.
+        template <typename T>
+        RefPtr<SceneLoadOperation> loadSceneAsync(const std::string& name);
         Scene* activeScene() const;
         Scene* sceneAt(uint32_t buildIndex) const;
         Scene* sceneByName(const std::string& name) const;
@@ -23,6 +63,10 @@ namespace GLaDOS {
         bool loadScene(const std::string& name);
         std::size_t sceneCount() const;
         bool isValidScene() const;
+        // main thread time given to scene activation per frame in seconds, a single step always runs
+        void setActivationBudget(real seconds);
+        real activationBudget() const;
+        std::size_t loadingSceneCount() const;
 
         void fixedUpdate(real fixedDeltaTime);
         void update(real deltaTime);
@@ -30,20 +74,29 @@ namespace GLaDOS {
 
       private:
         static Logger* logger;
+        static constexpr real defaultActivationBudget = 0.002f;
+
+        bool isNameTaken(const std::string& name) const;
+        void addScene(Scene* scene);
+        RefPtr<SceneLoadOperation> startLoad(Scene* scene, const std::string& name);
+        void activateLoadedScenes();
 
         UnorderedMap<uint32_t, Scene*> mScenes;
         Scene* mCurrentScene{nullptr};
         uint32_t mLastSceneCount{0};
+        FixedThreadPool* mLoadThreadPool{nullptr};  // created by the first loadSceneAsync
+        Vector<RefPtr<SceneLoadOperation>> mLoadOperations;
+        real mActivationBudget{defaultActivationBudget};
     };
 
     template <typename T>
     Scene* SceneManager::createScene(const std::string& name) {
-        if (sceneByName(name) != nullptr) {
+        if (isNameTaken(name)) {
             LOG_ERROR(logger, "Already exist scene name: `{0}`", name);
             return nullptr;
         }
 
-        T* scene = static_cast<T*>(MALLOC(sizeof(T)));
+        T* scene = static_cast<T*>(MALLOC_TAGGED(sizeof(T), MemoryTag::Scene));
         if (!scene) {
             return static_cast<T*>(nullptr);
         }
@@ -52,16 +105,44 @@ namespace GLaDOS {
         scene->mName = name;
         LOG_TRACE(logger, "Scene `{0}` created with buildIndex {1}.", scene->mName, scene->mBuildIndex);
 
+        if (!scene->onLoad()) {
+            LOG_TRACE(logger, "Failed to onLoad in scene `{0}`", scene->getName());
+            DELETE_T(scene, T);
+            return nullptr;
+        }
         if (!scene->onInit()) {
             LOG_TRACE(logger, "Failed to onInit in scene `{0}`", scene->getName());
-            FREE(scene);
+            DELETE_T(scene, T);
             return nullptr;
         }
-        mScenes.try_emplace(mLastSceneCount, scene);
-        mLastSceneCount++;
+        // steps may add steps
+        for (std::size_t i = 0; i < scene->mActivationSteps.size(); i++) {
+            std::function<void()> step = std::move(scene->mActivationSteps[i]);
+            step();
+        }
+        scene->mActivationSteps.clear();
+        addScene(scene);
 
         return scene;
     }
+
+    template <typename T>
+    RefPtr<SceneLoadOperation> SceneManager::loadSceneAsync(const std::string& name) {
+        if (isNameTaken(name)) {
+            LOG_ERROR(logger, "Already exist scene name: `{0}`", name);
+            return RefPtr<SceneLoadOperation>{};
+        }
+
+        T* scene = static_cast<T*>(MALLOC_TAGGED(sizeof(T), MemoryTag::Scene));
+        if (!scene) {
+            return RefPtr<SceneLoadOperation>{};
+        }
+        new (scene) T{};
+        scene->mName = name;
+        LOG_TRACE(logger, "Scene `{0}` started loading.", scene->mName);
+
+        return startLoad(scene, name);
+    }
 }  // namespace GLaDOS
 
 #endif  //GLADOS_SCENEMANAGER_H
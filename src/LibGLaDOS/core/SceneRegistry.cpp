@@ -0,0 +1,102 @@
+#include "SceneRegistry.h"
+
+#include "GameObject.hpp"
+
+namespace GLaDOS {
+    SceneRegistry::~SceneRegistry() {
+        for (Vector<Component*>& components : mComponents) {
+            for (Component* component : components) {
+                component->mRegistrySlot = Component::unregistered;
+            }
+        }
+        for (Vector<GameObject*>& gameObjects : mLayers) {
+            for (GameObject* gameObject : gameObjects) {
+                gameObject->mLayerSlot = GameObject::unregistered;
+            }
+        }
+    }
+
+    void SceneRegistry::insert(GameObject* gameObject) {
+        if (gameObject->mLayerSlot != GameObject::unregistered) {
+            return;
+        }
+        Vector<GameObject*>& layer = mLayers[gameObject->mLayer];
+        gameObject->mLayerSlot = static_cast<uint32_t>(layer.size());
+        layer.push_back(gameObject);
+        refresh(gameObject);
+    }
+
+    void SceneRegistry::remove(GameObject* gameObject) {
+        if (gameObject->mLayerSlot == GameObject::unregistered) {
+            return;
+        }
+        gameObject->forEachComponent([this](Component* component) {
+            removeComponent(component);
+        });
+
+        // swap and pop
+        Vector<GameObject*>& layer = mLayers[gameObject->mLayer];
+        GameObject* last = layer.back();
+        layer[gameObject->mLayerSlot] = last;
+        last->mLayerSlot = gameObject->mLayerSlot;
+        layer.pop_back();
+        gameObject->mLayerSlot = GameObject::unregistered;
+    }
+
+    void SceneRegistry::refresh(GameObject* gameObject) {
+        if (gameObject->mLayerSlot == GameObject::unregistered) {
+            return;
+        }
+        gameObject->forEachComponent([this](Component* component) {
+            if (component->mRegistrySlot == Component::unregistered) {
+                addComponent(component);
+            }
+        });
+    }
+
+    void SceneRegistry::removeComponent(Component* component) {
+        if (component->mRegistrySlot == Component::unregistered) {
+            return;
+        }
+
+        // swap and pop
+        Vector<Component*>& components = mComponents[component->mTypeId];
+        Component* last = components.back();
+        components[component->mRegistrySlot] = last;
+        last->mRegistrySlot = component->mRegistrySlot;
+        components.pop_back();
+        component->mRegistrySlot = Component::unregistered;
+    }
+
+    void SceneRegistry::changeLayer(GameObject* gameObject, uint32_t layer) {
+        if (gameObject->mLayerSlot == GameObject::unregistered) {
+            gameObject->mLayer = layer;
+            return;
+        }
+
+        Vector<GameObject*>& from = mLayers[gameObject->mLayer];
+        GameObject* last = from.back();
+        from[gameObject->mLayerSlot] = last;
+        last->mLayerSlot = gameObject->mLayerSlot;
+        from.pop_back();
+
+        Vector<GameObject*>& to = mLayers[layer];
+        gameObject->mLayer = layer;
+        gameObject->mLayerSlot = static_cast<uint32_t>(to.size());
+        to.push_back(gameObject);
+    }
+
+    const Vector<Component*>& SceneRegistry::componentsOf(ComponentTypeId id) const {
+        return mComponents[id];
+    }
+
+    const Vector<GameObject*>& SceneRegistry::objectsIn(uint32_t layer) const {
+        return mLayers[layer];
+    }
+
+    void SceneRegistry::addComponent(Component* component) {
+        Vector<Component*>& components = mComponents[component->mTypeId];
+        component->mRegistrySlot = static_cast<uint32_t>(components.size());
+        components.push_back(component);
+    }
+}  // namespace GLaDOS
@@ -0,0 +1,39 @@
+#ifndef GLADOS_SCENEREGISTRY_H
+#define GLADOS_SCENEREGISTRY_H
+
+#include "Component.h"
+#include "utils/Utility.h"
+
+namespace GLaDOS {
+    class GameObject;
+    // Dense arrays of the components of each type and the objects of each layer in a scene, kept up to date by
+    // addComponent/removeComponent/setLayer. Removal swaps the last entry in, so the order is unspecified.
+    class SceneRegistry {
+      public:
+        static constexpr uint32_t maxLayers = 64;
+
+        SceneRegistry() = default;
+        ~SceneRegistry();
+
+        // registers the object with its layer and every present component
+        void insert(GameObject* gameObject);
+        void remove(GameObject* gameObject);
+        // registers the components the object gained, objects that are not inserted are skipped
+        void refresh(GameObject* gameObject);
+        void removeComponent(Component* component);
+        void changeLayer(GameObject* gameObject, uint32_t layer);
+
+        const Vector<Component*>& componentsOf(ComponentTypeId id) const;
+        const Vector<GameObject*>& objectsIn(uint32_t layer) const;
+
+        DISALLOW_COPY_AND_ASSIGN(SceneRegistry);
+
+      private:
+        void addComponent(Component* component);
+
+        Vector<Component*> mComponents[maxComponentTypes];
+        Vector<GameObject*> mLayers[maxLayers];
+    };
+}  // namespace GLaDOS
+
+#endif  //GLADOS_SCENEREGISTRY_H
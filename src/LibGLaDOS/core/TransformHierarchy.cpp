@@ -0,0 +1,223 @@
+#include "TransformHierarchy.h"
+
+#include <algorithm>
+
+#include "GameObject.hpp"
+#include "core/component/Transform.h"
+
+namespace GLaDOS {
+    TransformHierarchy::~TransformHierarchy() {
+        setTrackMoves(false);
+        for (Transform* transform : mTransforms) {
+            if (transform != nullptr) {
+                transform->mHierarchyIndex = -1;
+            }
+        }
+    }
+
+    void TransformHierarchy::insert(GameObject* gameObject) {
+        Transform* transform = gameObject->mTransform;
+        if (transform == nullptr || transform->mHierarchyIndex >= 0) {
+            // objects under construction are inserted once they have a transform
+            return;
+        }
+
+        int32_t parent = -1;
+        if (gameObject->mParent != nullptr) {
+            Transform* parentTransform = gameObject->mParent->mTransform;
+            if (parentTransform == nullptr || parentTransform->mHierarchyIndex < 0) {
+                mNeedsRebuild = true;
+                return;
+            }
+            parent = parentTransform->mHierarchyIndex;
+        }
+        append(transform, parent);
+    }
+
+    void TransformHierarchy::remove(GameObject* gameObject) {
+        Transform* transform = gameObject->mTransform;
+        if (transform == nullptr || transform->mHierarchyIndex < 0) {
+            return;
+        }
+
+        if (transform->mMoveQueued) {
+            std::lock_guard<std::mutex> lock{mMovedMutex};
+            mMovedTransforms.erase(std::find(mMovedTransforms.begin(), mMovedTransforms.end(), transform));
+            transform->mMoveQueued = false;
+        }
+
+        // leave a hole, indices of the other transforms stay valid until the next rebuild
+        mTransforms[static_cast<std::size_t>(transform->mHierarchyIndex)] = nullptr;
+        transform->mHierarchyIndex = -1;
+        mRemovedCount++;
+        if (mRemovedCount * 2 > mTransforms.size()) {
+            mNeedsRebuild = true;
+        }
+    }
+
+    void TransformHierarchy::reparent(GameObject* gameObject) {
+        Transform* transform = gameObject->mTransform;
+        if (transform == nullptr || transform->mHierarchyIndex < 0) {
+            return;
+        }
+
+        int32_t parent = -1;
+        if (gameObject->mParent != nullptr && gameObject->mParent->mTransform != nullptr) {
+            parent = gameObject->mParent->mTransform->mHierarchyIndex;
+        }
+        if (parent > transform->mHierarchyIndex) {
+            // the new parent comes later, the order has to be rebuilt
+            mNeedsRebuild = true;
+            return;
+        }
+        mParents[static_cast<std::size_t>(transform->mHierarchyIndex)] = parent;
+    }
+
+    void TransformHierarchy::update(const Vector<GameObject*>& gameObjects) {
+        if (mNeedsRebuild) {
+            rebuild(gameObjects);
+        }
+
+        for (std::size_t index = 0; index < mTransforms.size(); index++) {
+            Transform* transform = mTransforms[index];
+            if (transform == nullptr || !transform->mLocalToWorldDirtyFlag) {
+                continue;
+            }
+
+            int32_t parent = mParents[index];
+            if (parent < 0 || mTransforms[static_cast<std::size_t>(parent)] == nullptr) {
+                // roots, and objects whose parent is not ordered
+                transform->refresh();
+                continue;
+            }
+
+            // the parent precedes, so its matrix is already up to date
+            const Mat4<real>& parentMatrix = mHierarchyMatrices[static_cast<std::size_t>(parent)];
+            Mat4<real> localMatrix = transform->localMatrix();
+            mHierarchyMatrices[index] = localMatrix * parentMatrix;
+            mWorldMatrices[index] = localMatrix * transform->worldMatrix() * parentMatrix;
+            transform->mHierarchyMatrixCache = mHierarchyMatrices[index];
+            transform->mLocalToWorldMatrixCache = mWorldMatrices[index];
+            transform->mLocalToWorldDirtyFlag = false;
+        }
+    }
+
+    std::size_t TransformHierarchy::size() const {
+        return mTransforms.size();
+    }
+
+    Transform* TransformHierarchy::transformAt(std::size_t index) const {
+        return mTransforms[index];
+    }
+
+    int32_t TransformHierarchy::parentAt(std::size_t index) const {
+        return mParents[index];
+    }
+
+    const Vector<Mat4<real>>& TransformHierarchy::hierarchyMatrices() const {
+        return mHierarchyMatrices;
+    }
+
+    const Vector<Mat4<real>>& TransformHierarchy::worldMatrices() const {
+        return mWorldMatrices;
+    }
+
+    void TransformHierarchy::setTrackMoves(bool track) {
+        if (mTrackMoves == track) {
+            return;
+        }
+        mTrackMoves = track;
+        if (track) {
+            for (Transform* transform : mTransforms) {
+                if (transform != nullptr) {
+                    markMoved(transform);
+                }
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock{mMovedMutex};
+        for (Transform* transform : mMovedTransforms) {
+            transform->mMoveQueued = false;
+        }
+        mMovedTransforms.clear();
+    }
+
+    void TransformHierarchy::takeMovedTransforms(Vector<Transform*>& moved) {
+        std::lock_guard<std::mutex> lock{mMovedMutex};
+        moved.clear();
+        moved.swap(mMovedTransforms);
+        for (Transform* transform : moved) {
+            transform->mMoveQueued = false;
+        }
+    }
+
+    void TransformHierarchy::rebuild(const Vector<GameObject*>& gameObjects) {
+        for (Transform* transform : mTransforms) {
+            if (transform != nullptr) {
+                transform->mHierarchyIndex = -1;
+            }
+        }
+        mTransforms.clear();
+        mParents.clear();
+        mHierarchyMatrices.clear();
+        mWorldMatrices.clear();
+        mRemovedCount = 0;
+        mNeedsRebuild = false;
+
+        // breadth first from the roots, so parents precede their children
+        for (GameObject* gameObject : gameObjects) {
+            if (gameObject->mParent == nullptr && gameObject->mTransform != nullptr) {
+                append(gameObject->mTransform, -1);
+            }
+        }
+        for (std::size_t index = 0; index < mTransforms.size(); index++) {
+            GameObject* gameObject = mTransforms[index]->mGameObject;
+            for (GameObject* child : gameObject->mChildren) {
+                Transform* transform = child->mTransform;
+                if (child->mScene == gameObject->mScene && transform != nullptr && transform->mHierarchyIndex < 0) {
+                    append(transform, static_cast<int32_t>(index));
+                }
+            }
+        }
+        // parent lives outside of this scene
+        for (GameObject* gameObject : gameObjects) {
+            if (gameObject->mTransform != nullptr && gameObject->mTransform->mHierarchyIndex < 0) {
+                append(gameObject->mTransform, -1);
+            }
+        }
+
+        // changes made while the order was stale did not reach every descendant
+        for (Transform* transform : mTransforms) {
+            transform->mLocalToWorldDirtyFlag = true;
+            transform->mWorldToLocalDirtyFlag = true;
+        }
+    }
+
+    void TransformHierarchy::append(Transform* transform, int32_t parent) {
+        transform->mHierarchyIndex = static_cast<int32_t>(mTransforms.size());
+        mTransforms.push_back(transform);
+        mParents.push_back(parent);
+        mHierarchyMatrices.push_back(transform->mHierarchyMatrixCache);
+        mWorldMatrices.push_back(transform->mLocalToWorldMatrixCache);
+        markMoved(transform);
+    }
+
+    void TransformHierarchy::store(int32_t index, const Mat4<real>& hierarchyMatrix, const Mat4<real>& worldMatrix) {
+        // callers check for -1 before storing
+        auto slot = static_cast<std::size_t>(index);
+        mHierarchyMatrices[slot] = hierarchyMatrix;
+        mWorldMatrices[slot] = worldMatrix;
+    }
+
+    void TransformHierarchy::markMoved(Transform* transform) {
+        if (!mTrackMoves) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock{mMovedMutex};
+        if (!transform->mMoveQueued) {
+            transform->mMoveQueued = true;
+            mMovedTransforms.push_back(transform);
+        }
+    }
+}  // namespace GLaDOS
@@ -0,0 +1,63 @@
+#ifndef GLADOS_TRANSFORMHIERARCHY_H
+#define GLADOS_TRANSFORMHIERARCHY_H
+
+#include <cstdint>
+#include <mutex>
+
+#include "math/Mat4.hpp"
+#include "utils/Utility.h"
+
+namespace GLaDOS {
+    class GameObject;
+    class Transform;
+    // Transforms of a scene flattened into arrays where a parent always comes before its children.
+    // update() recomputes dirty transforms in one linear pass, so every parent matrix is ready
+    // when its children are visited and no transform walks its ancestors.
+    class TransformHierarchy {
+        friend class Transform;
+
+      public:
+        TransformHierarchy() = default;
+        ~TransformHierarchy();
+
+        // appends the object, or schedules a rebuild if its parent is not ordered yet
+        void insert(GameObject* gameObject);
+        void remove(GameObject* gameObject);
+        // the parent of the object changed
+        void reparent(GameObject* gameObject);
+        // rebuilds the order from `gameObjects` if needed, then recomputes every dirty transform
+        void update(const Vector<GameObject*>& gameObjects);
+
+        std::size_t size() const;  // including removed slots until the next rebuild
+        Transform* transformAt(std::size_t index) const;  // nullptr for a removed slot
+        int32_t parentAt(std::size_t index) const;  // -1 for a root
+        // valid for transforms which are not dirty, in hierarchy order
+        const Vector<Mat4<real>>& hierarchyMatrices() const;
+        const Vector<Mat4<real>>& worldMatrices() const;
+        // Collects transforms which were added or made dirty while tracking is on, see Scene::setSpatialIndex.
+        // Turning it on collects every transform.
+        void setTrackMoves(bool track);
+        // hands out the transforms moved since the last call
+        void takeMovedTransforms(Vector<Transform*>& moved);
+
+        DISALLOW_COPY_AND_ASSIGN(TransformHierarchy);
+
+      private:
+        void rebuild(const Vector<GameObject*>& gameObjects);
+        void append(Transform* transform, int32_t parent);
+        void store(int32_t index, const Mat4<real>& hierarchyMatrix, const Mat4<real>& worldMatrix);
+        void markMoved(Transform* transform);  // Transform::dirty may run on an update worker
+
+        Vector<Transform*> mTransforms;
+        Vector<int32_t> mParents;
+        Vector<Mat4<real>> mHierarchyMatrices;  // local matrices of a transform and its ancestors
+        Vector<Mat4<real>> mWorldMatrices;  // same as Transform::localToWorldMatrix()
+        std::size_t mRemovedCount{0};
+        bool mNeedsRebuild{false};
+        std::mutex mMovedMutex;
+        Vector<Transform*> mMovedTransforms;
+        bool mTrackMoves{false};
+    };
+}  // namespace GLaDOS
+
+#endif  //GLADOS_TRANSFORMHIERARCHY_H
@@ -86,7 +86,7 @@ namespace GLaDOS {
     }
 
     Component* Animator::clone() {
-        Animator* animator = NEW_T(Animator);
+        Animator* animator = newComponent<Animator>();
         animator->mIsActive = mIsActive;
         for (const auto& pair : mAnimations) {
             animator->mAnimations.insert(std::make_pair(pair.first, NEW_T(AnimationState(*pair.second))));
@@ -24,6 +24,7 @@ namespace GLaDOS {
         void getClipNames(Vector<std::string>& clips) const;
         bool isPlaying() const;
         std::size_t length() const;
+        UpdatePhase updatePhase() const override { return UpdatePhase::Animation; }
 
       protected:
         void fixedUpdate(real fixedDeltaTime) override;
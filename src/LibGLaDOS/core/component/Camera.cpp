@@ -11,10 +11,6 @@ namespace GLaDOS {
     Camera::Camera() : Component{"Camera"} {
     }
 
-    Camera::Camera(const Vec3& pos) : Component{"Camera"} {
-        mGameObject->transform()->setLocalPosition(pos);
-    }
-
     Mat4<real> Camera::projectionMatrix() const {
         if (mProjectionDirtyFlag) {
             if (mIsOrthographic) {
@@ -38,7 +34,7 @@ namespace GLaDOS {
     }
 
     Mat4<real> Camera::cameraToWorldMatrix() const {
-        return Mat4<real>::inverse(worldToCameraMatrix());
+        return Mat4<real>::inverseAffine(worldToCameraMatrix());
     }
 
     Ray Camera::screenPointToRay(const Vec3& pos) {
@@ -180,7 +176,7 @@ namespace GLaDOS {
     }
 
     Component* Camera::clone() {
-        Camera* camera = NEW_T(Camera);
+        Camera* camera = newComponent<Camera>();
         camera->mIsActive = mIsActive;
         camera->mFieldOfView = mFieldOfView;
         camera->mNearClipPlane = mNearClipPlane;
@@ -12,9 +12,11 @@ namespace GLaDOS {
     class Camera : public Component {
       public:
         Camera();
-        explicit Camera(const Vec3& pos);
         ~Camera() override = default;
 
+        // update only follows the drawable size of its own projection
+        bool isThreadSafe() const override { return true; }
+
         Mat4<real> projectionMatrix() const;
         Mat4<real> worldToCameraMatrix() const;
         Mat4<real> cameraToWorldMatrix() const;
@@ -9,6 +9,10 @@ namespace GLaDOS {
 
     }
 
+    bool LightSource::needsUpdate() const {
+        return false;
+    }
+
     void LightSource::fixedUpdate(real fixedDeltaTime) {
     }
 
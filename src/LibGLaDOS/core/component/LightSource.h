@@ -9,6 +9,8 @@ namespace GLaDOS {
         LightSource();
         ~LightSource();
 
+        bool needsUpdate() const override;
+
       protected:
         void fixedUpdate(real fixedDeltaTime) override;
         void update(real deltaTime) override;
@@ -1,5 +1,7 @@
 #include "Transform.h"
 #include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/TransformHierarchy.h"
 #include "math/Mat4.hpp"
 #include "math/Vec3.h"
 #include "math/Quat.h"
@@ -111,16 +113,13 @@ namespace GLaDOS {
     }
 
     Mat4<real> Transform::localToWorldMatrix() const {
-        if (mLocalToWorldDirtyFlag) {
-            mLocalToWorldMatrixCache = localMatrix() * worldMatrix() * parentLocalMatrix();
-            mLocalToWorldDirtyFlag = false;
-        }
+        refresh();
         return mLocalToWorldMatrixCache;
     }
 
     Mat4<real> Transform::worldToLocalMatrix() const {
         if (mWorldToLocalDirtyFlag) {
-            mWorldToLocalMatrixCache = Mat4<real>::inverse(localToWorldMatrix());
+            mWorldToLocalMatrixCache = Mat4<real>::inverseAffine(localToWorldMatrix());
             mWorldToLocalDirtyFlag = false;
         }
         return mWorldToLocalMatrixCache;
@@ -171,10 +170,17 @@ namespace GLaDOS {
     }
 
     void Transform::setParent(GameObject* parent) {
-        mGameObject->mParent->removeChildren(mGameObject);
+        if (mGameObject->mParent != nullptr) {
+            mGameObject->mParent->removeChildren(mGameObject);
+        }
         mGameObject->mParent = parent;
-        mGameObject->mParent->addChildren(mGameObject);
+        if (parent != nullptr) {
+            parent->addChildren(mGameObject);
+        }
         dirty();
+        if (mHierarchyIndex >= 0) {
+            mGameObject->scene()->transformHierarchy()->reparent(mGameObject);
+        }
     }
 
     void Transform::decomposeSRT(const Mat4<real>& transform) {
@@ -259,11 +265,36 @@ namespace GLaDOS {
 
     Mat4<real> Transform::parentLocalMatrix() const {
         GameObject* parentTransform = parent();
-        if ((mGameObject == nullptr) || (parentTransform == nullptr)) {
+        if ((mGameObject == nullptr) || (parentTransform == nullptr) || (parentTransform->mTransform == nullptr)) {
             return Mat4<real>::identity();
         }
 
-        return parentTransform->mTransform->localMatrix() * parentTransform->mTransform->parentLocalMatrix();
+        return parentTransform->mTransform->hierarchyMatrix();
+    }
+
+    Mat4<real> Transform::hierarchyMatrix() const {
+        refresh();
+        return mHierarchyMatrixCache;
+    }
+
+    void Transform::refresh() const {
+        if (!mLocalToWorldDirtyFlag) {
+            return;
+        }
+
+        // refreshes the ancestors first, so a clean transform never has a dirty parent
+        Mat4<real> parentMatrix = parentLocalMatrix();
+        Mat4<real> local = localMatrix();
+        mHierarchyMatrixCache = local * parentMatrix;
+        mLocalToWorldMatrixCache = local * worldMatrix() * parentMatrix;
+        mLocalToWorldDirtyFlag = false;
+        if (mHierarchyIndex >= 0) {
+            mGameObject->scene()->transformHierarchy()->store(mHierarchyIndex, mHierarchyMatrixCache, mLocalToWorldMatrixCache);
+        }
+    }
+
+    bool Transform::needsUpdate() const {
+        return false;
     }
 
     void Transform::fixedUpdate(real fixedDeltaTime) {
@@ -279,7 +310,7 @@ namespace GLaDOS {
     }
 
     Component* Transform::clone() {
-        Transform* transform = NEW_T(Transform);
+        Transform* transform = newComponent<Transform>();
         transform->mIsActive = mIsActive;
         transform->mPosition = mPosition;
         transform->mRotation = mRotation;
@@ -291,7 +322,28 @@ namespace GLaDOS {
     }
 
     void Transform::dirty() {
-        mLocalToWorldDirtyFlag = true;
+        if (mHierarchyIndex >= 0 && mGameObject->scene()->deferTransformChange(this)) {
+            // moved by a thread safe component, applied after its phase
+            return;
+        }
+        if (mHierarchyIndex >= 0 && mGameObject->mWakeOnMoveMask != 0) {
+            mGameObject->wakeOnTransformChange();
+        }
         mWorldToLocalDirtyFlag = true;
+        if (mLocalToWorldDirtyFlag) {
+            // descendants are dirty already, see refresh()
+            return;
+        }
+        mLocalToWorldDirtyFlag = true;
+        if (mHierarchyIndex < 0) {
+            // not in a scene, the game object may not be set
+            return;
+        }
+        mGameObject->scene()->transformHierarchy()->markMoved(this);
+        for (GameObject* child : mGameObject->mChildren) {
+            if (child->mTransform != nullptr) {
+                child->mTransform->dirty();
+            }
+        }
     }
 }  // namespace GLaDOS
\ No newline at end of file
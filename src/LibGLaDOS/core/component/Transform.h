@@ -12,10 +12,14 @@ namespace GLaDOS {
     class Mat4;
     class Transform : public Component {
         friend class TransformCurve;
+        friend class TransformHierarchy;
+        friend class Scene;
       public:
         Transform();
         ~Transform() override = default;
 
+        bool needsUpdate() const override;  // world matrices are refreshed by the TransformHierarchy
+
         void translate(const Vec3& translation, Space relativeTo = Space::Self);
         void rotate(const UVec3& axis, Deg angle, Space relativeTo = Space::Self);
         void rotate(const Vec3& eulerAngles, Space relativeTo = Space::Self);
@@ -62,6 +66,7 @@ namespace GLaDOS {
         Mat4<real> worldMatrix() const;
         Mat4<real> localMatrix() const;
         Mat4<real> parentLocalMatrix() const;
+        Mat4<real> hierarchyMatrix() const;  // localMatrix() of this transform and all its ancestors
 
       protected:
         void fixedUpdate(real fixedDeltaTime) override;
@@ -71,16 +76,21 @@ namespace GLaDOS {
         void dirty();
 
       private:
+        void refresh() const;
+
         Vec3 mPosition{Vec3::zero};
         Quat mRotation;
         Vec3 mLossyScale{Vec3::one};
         Vec3 mLocalPosition{Vec3::zero};
         Quat mLocalRotation;
         Vec3 mLocalScale{Vec3::one};
+        mutable Mat4<real> mHierarchyMatrixCache;
         mutable Mat4<real> mLocalToWorldMatrixCache;
-        mutable bool mLocalToWorldDirtyFlag{true};
+        mutable bool mLocalToWorldDirtyFlag{true};  // also covers mHierarchyMatrixCache
         mutable Mat4<real> mWorldToLocalMatrixCache;
         mutable bool mWorldToLocalDirtyFlag{true};
+        int32_t mHierarchyIndex{-1};  // slot in the TransformHierarchy of the scene, -1 if not in a scene
+        bool mMoveQueued{false};  // waits in TransformHierarchy::takeMovedTransforms
     };
 }  // namespace GLaDOS
 
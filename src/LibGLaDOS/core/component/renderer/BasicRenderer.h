@@ -11,6 +11,8 @@ namespace GLaDOS {
         virtual ~BasicRenderer() {}
 
         Renderable* getRenderable() { return mRenderable; }
+        // renderers upload world matrices, so they update after the transform hierarchy
+        UpdatePhase updatePhase() const override { return UpdatePhase::RendererPrep; }
 
       protected:
         void fixedUpdate(real fixedDeltaTime) override {}
@@ -1,5 +1,9 @@
 #include "BoneRenderer.h"
 
+#include "platform/Platform.h"
+#include "platform/render/Renderable.h"
+#include "platform/render/Renderer.h"
+
 namespace GLaDOS {
     BoneRenderer::BoneRenderer() {
     }
@@ -16,6 +20,11 @@ namespace GLaDOS {
     }
 
     Component* BoneRenderer::clone() {
-        return MeshRenderer::clone();
+        BoneRenderer* boneRenderer = newComponent<BoneRenderer>();
+        boneRenderer->mIsActive = mIsActive;
+        if (mRenderable != nullptr) {
+            boneRenderer->mRenderable = Platform::getRenderer().createRenderable(mRenderable->getMesh(), mRenderable->getMaterial());
+        }
+        return boneRenderer;
     }
 }
\ No newline at end of file
@@ -45,7 +45,7 @@ namespace GLaDOS {
     }
 
     Component* CubemapRenderer::clone() {
-        CubemapRenderer* cubemapRenderer = NEW_T(CubemapRenderer);
+        CubemapRenderer* cubemapRenderer = newComponent<CubemapRenderer>();
         cubemapRenderer->mIsActive = mIsActive;
         cubemapRenderer->mRenderable = createRenderable();
         cubemapRenderer->setTextureCube(static_cast<TextureCube*>(mRenderable->getMaterial()->getTexture0()));
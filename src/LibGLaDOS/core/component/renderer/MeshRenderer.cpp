@@ -42,7 +42,7 @@ namespace GLaDOS {
 
             shaderProgram->setUniform("model", model);
             shaderProgram->setUniform("modelViewProj", modelView * mainCamera->projectionMatrix());
-            shaderProgram->setUniform("transInvModelView", Mat4<real>::transpose(Mat4<real>::inverse(modelView)));
+            shaderProgram->setUniform("transInvModelView", Mat4<real>::transpose(Mat4<real>::inverseAffine(modelView)));
             shaderProgram->setUniform("viewPos", mainCamera->gameObject()->transform()->position());
             shaderProgram->setUniform("albedo", material->getAlbedo());
             shaderProgram->setUniform("specular", material->getSpecular());
@@ -60,9 +60,12 @@ namespace GLaDOS {
     }
 
     Component* MeshRenderer::clone() {
-        MeshRenderer* meshRenderer = NEW_T(MeshRenderer);
+        MeshRenderer* meshRenderer = newComponent<MeshRenderer>();
         meshRenderer->mIsActive = mIsActive;
-        meshRenderer->mRenderable = Platform::getRenderer().createRenderable(NEW_T(Mesh(*mRenderable->getMesh())), NEW_T(Material(*mRenderable->getMaterial())));
+        if (mRenderable != nullptr) {
+            // the mesh and the material are shared, not copied
+            meshRenderer->mRenderable = Platform::getRenderer().createRenderable(mRenderable->getMesh(), mRenderable->getMaterial());
+        }
         return meshRenderer;
     }
 }  // namespace GLaDOS
\ No newline at end of file
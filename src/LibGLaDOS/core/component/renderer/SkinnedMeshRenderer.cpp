@@ -25,19 +25,22 @@ namespace GLaDOS {
         mRootBone = gameObject;
     }
 
-    void SkinnedMeshRenderer::buildMatrixPalette(GameObject* node, Mesh* mesh, const Mat4<real>& parentMatrix, std::size_t& matrixIndex) {
+    GameObject* SkinnedMeshRenderer::getRootBone() const {
+        return mRootBone;
+    }
+
+    void SkinnedMeshRenderer::buildMatrixPalette(GameObject* node, Mesh* mesh, std::size_t& matrixIndex) {
         // Pre Order Traversal in children nodes
         if (node == nullptr) {
             return;
         }
-        // caching to-parent matrix
-        Mat4<real> transformMatrix = node->transform()->localMatrix() * parentMatrix;
-        // bine pose * to root transform
-        mMatrixPalette[matrixIndex++] = mesh->getBindPose(matrixIndex) * transformMatrix;
+        // to-root matrix is cached by the transform hierarchy of the scene
+        mMatrixPalette[matrixIndex] = mesh->getBindPose(matrixIndex) * node->transform()->hierarchyMatrix();
+        matrixIndex++;
 
-        Vector<GameObject*> children = node->getChildren();
+        FrameVector<GameObject*> children = node->getChildrenInFrame();
         for (uint32_t i = 0; i < children.size(); i++) {
-            buildMatrixPalette(children[i], mesh, transformMatrix, matrixIndex);
+            buildMatrixPalette(children[i], mesh, matrixIndex);
         }
     }
 
@@ -46,7 +49,7 @@ namespace GLaDOS {
             ShaderProgram* shaderProgram = mRenderable->getMaterial()->getShaderProgram();
             Mesh* mesh = mRenderable->getMesh();
             std::size_t matrixIndex = 0;
-            buildMatrixPalette(mRootBone, mesh, mRootBone->transform()->parentLocalMatrix(), matrixIndex);
+            buildMatrixPalette(mRootBone, mesh, matrixIndex);
             shaderProgram->setUniform("boneTransform", mMatrixPalette.data(), mMatrixPalette.size());
         }
 
@@ -58,7 +61,17 @@ namespace GLaDOS {
     }
 
     Component* SkinnedMeshRenderer::clone() {
-        // TODO
-        return nullptr;
+        SkinnedMeshRenderer* skinnedMeshRenderer = newComponent<SkinnedMeshRenderer>();
+        skinnedMeshRenderer->mIsActive = mIsActive;
+        if (mRenderable != nullptr) {
+            skinnedMeshRenderer->mRenderable = Platform::getRenderer().createRenderable(mRenderable->getMesh(), mRenderable->getMaterial());
+        }
+        // still the bone of the original, onCloned moves it to the copy
+        skinnedMeshRenderer->mRootBone = mRootBone;
+        return skinnedMeshRenderer;
+    }
+
+    void SkinnedMeshRenderer::onCloned(const CloneMap& clones) {
+        mRootBone = cloneOf(clones, mRootBone);
     }
 }
\ No newline at end of file
@@ -15,19 +15,21 @@ namespace GLaDOS {
         ~SkinnedMeshRenderer() override;
 
         void setRootBone(GameObject* gameObject);
+        GameObject* getRootBone() const;
 
       protected:
         void update(real deltaTime) override;
         void render() override;
         Component* clone() override;
+        void onCloned(const CloneMap& clones) override;
 
       private:
         static Logger* logger;
         static constexpr std::size_t MAX_BONE_MATRIX = 96;
 
-        void buildMatrixPalette(GameObject* node, Mesh* mesh, const Mat4<real>& parentMatrix, std::size_t& matrixIndex);
+        void buildMatrixPalette(GameObject* node, Mesh* mesh, std::size_t& matrixIndex);
 
-        GameObject* mRootBone;
+        GameObject* mRootBone{nullptr};
         Vector<Mat4<real>> mMatrixPalette{MAX_BONE_MATRIX};
     };
 }  // namespace GLaDOS
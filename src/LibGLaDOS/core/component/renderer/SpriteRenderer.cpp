@@ -109,7 +109,7 @@ namespace GLaDOS {
     }
 
     Component* SpriteRenderer::clone() {
-        SpriteRenderer* spriteRenderer = NEW_T(SpriteRenderer);
+        SpriteRenderer* spriteRenderer = newComponent<SpriteRenderer>();
         spriteRenderer->mIsActive = mIsActive;
         spriteRenderer->mSprite = NEW_T(Sprite(*mSprite));
         spriteRenderer->mRenderable = spriteRenderer->mSprite->getRenderable();
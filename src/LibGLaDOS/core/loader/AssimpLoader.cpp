@@ -236,6 +236,8 @@ namespace GLaDOS {
             }
         }
 
+        // payloads and the GPU buffers built from them are accounted to the mesh, not only the buffer objects
+        ScopedMemoryTag memoryTag{MemoryTag::Mesh};
         VertexBuffer* vertexBuffer = NEW_T(VertexBuffer(vertexDesc, vertices.size()));
         vertexBuffer->copyBufferData(vertices.data());
         IndexBuffer* indexBuffer = NEW_T(IndexBuffer(sizeof(uint32_t), indices.size()));
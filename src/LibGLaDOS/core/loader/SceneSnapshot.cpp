@@ -0,0 +1,354 @@
+#include "SceneSnapshot.h"
+
+#include <cstdio>
+
+#include "core/Scene.h"
+#include "core/component/Camera.h"
+#include "core/component/Transform.h"
+#include "math/Rect.hpp"
+
+namespace GLaDOS {
+    namespace {
+        struct CameraRecord {
+            float fieldOfView;
+            float nearClipPlane;
+            float farClipPlane;
+            float unitSize;
+            float viewport[4];
+            uint32_t orthographic;
+            uint32_t padding;
+        };
+
+        constexpr std::size_t snapshotAlignment = 8;
+        constexpr uint32_t swappedMagic = 0x474C5353;  // SceneSnapshot::magic read in the other byte order
+
+        // appends `size` bytes at the next aligned offset and returns the offset
+        uint64_t append(Vector<std::byte>& file, const void* data, std::size_t size) {
+            std::size_t offset = alignment(file.size(), snapshotAlignment);
+            file.resize(offset + size);
+            if (size != 0) {
+                std::memcpy(file.data() + offset, data, size);
+            }
+            return offset;
+        }
+    }  // namespace
+
+    SnapshotString SnapshotStringTable::add(const std::string& value) {
+        auto iter = mOffsets.find(value);
+        if (iter != mOffsets.end()) {
+            return iter->second;
+        }
+        SnapshotString result{static_cast<uint32_t>(mData.size()), static_cast<uint32_t>(value.size())};
+        mData.insert(mData.end(), value.begin(), value.end());
+        mOffsets.try_emplace(value, result);
+        return result;
+    }
+
+    const Vector<char>& SnapshotStringTable::data() const {
+        return mData;
+    }
+
+    Logger* SceneSnapshot::logger = LoggerRegistry::getInstance().makeAndGetLogger("SceneSnapshot");
+
+    bool SceneSnapshot::save(Scene* scene, Blob& output) {
+        if (scene == nullptr) {
+            return false;
+        }
+
+        // parents before children, breadth first from the roots
+        Vector<GameObject*> objects;
+        for (GameObject* gameObject : scene->mGameObjects) {
+            if (!gameObject->isPendingDestroy() && gameObject->transform()->parent() == nullptr) {
+                objects.emplace_back(gameObject);
+            }
+        }
+        for (std::size_t i = 0; i < objects.size(); i++) {
+            for (GameObject* child : objects[i]->getChildren()) {
+                if (!child->isPendingDestroy()) {
+                    objects.emplace_back(child);
+                }
+            }
+        }
+
+        SnapshotStringTable strings;
+        Vector<SnapshotObject> objectTable(objects.size());
+        Vector<SnapshotTransform> transformTable(objects.size());
+        UnorderedMap<const GameObject*, int32_t> indices;
+        int32_t mainCamera = -1;
+        GameObject* cameraObject = scene->getMainCamera() != nullptr ? scene->getMainCamera()->gameObject() : nullptr;
+        for (std::size_t i = 0; i < objects.size(); i++) {
+            GameObject* gameObject = objects[i];
+            Transform* transform = gameObject->transform();
+            GameObject* parent = transform->parent();
+            indices.try_emplace(gameObject, static_cast<int32_t>(i));
+            if (gameObject == cameraObject) {
+                mainCamera = static_cast<int32_t>(i);
+            }
+
+            objectTable[i] = {strings.add(gameObject->getName()), parent != nullptr ? indices[parent] : -1, gameObject->isActive() ? 1u : 0u};
+            Vec3 position = transform->localPosition();
+            Quat rotation = transform->localRotation();
+            Vec3 scale = transform->localScale();
+            transformTable[i] = {{position.x, position.y, position.z}, {rotation.w, rotation.x, rotation.y, rotation.z}, {scale.x, scale.y, scale.z}, 0};
+        }
+
+        Vector<std::byte> file;
+        SnapshotHeader header{};
+        append(file, &header, sizeof(header));
+        header.magic = magic;
+        header.version = version;
+        header.objectCount = static_cast<uint32_t>(objects.size());
+        header.mainCamera = mainCamera;
+        header.objectsOffset = append(file, objectTable.data(), sizeof(SnapshotObject) * objectTable.size());
+        header.transformsOffset = append(file, transformTable.data(), sizeof(SnapshotTransform) * transformTable.size());
+
+        Vector<SnapshotSection> sections;
+        Vector<std::byte> records;
+        Vector<uint32_t> owners;
+        for (const Codec& codec : codecs()) {
+            records.clear();
+            owners.clear();
+            for (std::size_t i = 0; i < objects.size(); i++) {
+                std::size_t offset = records.size();
+                records.resize(offset + codec.recordSize, std::byte{0});
+                if (codec.write(objects[i], records.data() + offset, strings)) {
+                    owners.emplace_back(static_cast<uint32_t>(i));
+                } else {
+                    records.resize(offset);
+                }
+            }
+            if (owners.empty()) {
+                continue;
+            }
+            SnapshotSection section{};
+            section.typeName = strings.add(codec.typeName);
+            section.count = static_cast<uint32_t>(owners.size());
+            section.recordSize = codec.recordSize;
+            section.objectsOffset = append(file, owners.data(), sizeof(uint32_t) * owners.size());
+            section.recordsOffset = append(file, records.data(), records.size());
+            sections.emplace_back(section);
+        }
+        header.sectionCount = static_cast<uint32_t>(sections.size());
+        header.sectionsOffset = append(file, sections.data(), sizeof(SnapshotSection) * sections.size());
+        header.stringsSize = static_cast<uint32_t>(strings.data().size());
+        header.stringsOffset = append(file, strings.data().data(), strings.data().size());
+        std::memcpy(file.data(), &header, sizeof(header));
+
+        output.resize(file.size());
+        output.copyFrom(file);
+        return true;
+    }
+
+    bool SceneSnapshot::save(Scene* scene, const std::string& path) {
+        Blob blob;
+        if (!save(scene, blob)) {
+            return false;
+        }
+
+        FILE* file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            LOG_ERROR(logger, "Failed to open `{0}` for writing", path);
+            return false;
+        }
+        bool written = std::fwrite(blob.constPointer(), 1, blob.size(), file) == blob.size();
+        std::fclose(file);
+        if (!written) {
+            LOG_ERROR(logger, "Failed to write snapshot `{0}`", path);
+        }
+        return written;
+    }
+
+    bool SceneSnapshot::open(const std::string& path) {
+        Blob blob;
+        if (!blob.mapFile(path)) {
+            return false;
+        }
+        return open(std::move(blob));
+    }
+
+    bool SceneSnapshot::open(Blob blob) {
+        mBlob = std::move(blob);
+        mHeader = nullptr;
+        if (!validate()) {
+            mBlob.clear();
+            return false;
+        }
+        mHeader = BlobView{mBlob}.as<SnapshotHeader>();
+        return true;
+    }
+
+    bool SceneSnapshot::instantiate(Scene* scene) const {
+        if (scene == nullptr || mHeader == nullptr) {
+            return false;
+        }
+
+        const auto* objects = arrayAt<SnapshotObject>(mHeader->objectsOffset, mHeader->objectCount);
+        const auto* transforms = arrayAt<SnapshotTransform>(mHeader->transformsOffset, mHeader->objectCount);
+        GameObject* cameraObject = scene->getMainCamera() != nullptr ? scene->getMainCamera()->gameObject() : nullptr;
+        Vector<GameObject*> created(mHeader->objectCount, nullptr);
+        for (uint32_t i = 0; i < mHeader->objectCount; i++) {
+            const SnapshotObject& object = objects[i];
+            GameObject* parent = object.parent >= 0 ? created[static_cast<std::size_t>(object.parent)] : nullptr;
+            GameObject* gameObject = nullptr;
+            if (static_cast<int32_t>(i) == mHeader->mainCamera && cameraObject != nullptr) {
+                gameObject = cameraObject;
+                gameObject->setName(string(object.name));
+                if (parent != nullptr) {
+                    gameObject->transform()->setParent(parent);
+                }
+            } else if (parent != nullptr) {
+                gameObject = scene->createGameObject(string(object.name), parent);
+            } else {
+                gameObject = scene->createGameObject(string(object.name));
+            }
+            if (gameObject == nullptr) {
+                LOG_ERROR(logger, "Failed to create GameObject {0} of the snapshot", i);
+                return false;
+            }
+
+            const SnapshotTransform& local = transforms[i];
+            Transform* transform = gameObject->transform();
+            transform->setLocalPosition(Vec3{local.localPosition[0], local.localPosition[1], local.localPosition[2]});
+            transform->setLocalRotation(Quat{local.localRotation[0], local.localRotation[1], local.localRotation[2], local.localRotation[3]});
+            transform->setLocalScale(Vec3{local.localScale[0], local.localScale[1], local.localScale[2]});
+            if (object.active == 0) {
+                gameObject->active(false);
+            }
+            created[i] = gameObject;
+        }
+
+        const auto* sections = arrayAt<SnapshotSection>(mHeader->sectionsOffset, mHeader->sectionCount);
+        for (uint32_t s = 0; s < mHeader->sectionCount; s++) {
+            const SnapshotSection& section = sections[s];
+            std::string typeName = string(section.typeName);
+            const Codec* codec = findCodec(typeName);
+            if (codec == nullptr || codec->recordSize != section.recordSize) {
+                LOG_WARN(logger, "No codec for {0} components of type `{1}`, skipped", section.count, typeName);
+                continue;
+            }
+            const auto* owners = arrayAt<uint32_t>(section.objectsOffset, section.count);
+            const std::byte* records = mBlob.view().subView(static_cast<std::size_t>(section.recordsOffset), std::size_t{section.count} * section.recordSize).data();
+            for (uint32_t r = 0; r < section.count; r++) {
+                if (!codec->read(created[owners[r]], records + std::size_t{r} * section.recordSize, *this)) {
+                    LOG_WARN(logger, "Failed to read `{0}` component of `{1}`", typeName, created[owners[r]]->getName());
+                }
+            }
+        }
+
+        return true;
+    }
+
+    std::size_t SceneSnapshot::objectCount() const {
+        return mHeader != nullptr ? mHeader->objectCount : 0;
+    }
+
+    std::string SceneSnapshot::string(SnapshotString value) const {
+        if (mHeader == nullptr || value.length == 0 || std::size_t{value.offset} + value.length > mHeader->stringsSize) {
+            return std::string{};
+        }
+        const auto* chars = reinterpret_cast<const char*>(mBlob.view().data() + mHeader->stringsOffset + value.offset);
+        return std::string{chars, value.length};
+    }
+
+    Vector<SceneSnapshot::Codec>& SceneSnapshot::codecs() {
+        // built-ins are added by the initializer of the static, which runs once even if threads race to it
+        static Vector<Codec> registered = [] {
+            Vector<Codec> builtins;
+            builtins.emplace_back(makeCodec<Camera, CameraRecord>(
+                "Camera",
+                [](Camera& camera, CameraRecord& record, SnapshotStringTable&) {
+                    Rect<real> viewport = camera.getViewportRect();
+                    record.fieldOfView = camera.fieldOfView().get();
+                    record.nearClipPlane = camera.nearClipPlane();
+                    record.farClipPlane = camera.farClipPlane();
+                    record.unitSize = camera.getUnitSize();
+                    record.viewport[0] = viewport.x;
+                    record.viewport[1] = viewport.y;
+                    record.viewport[2] = viewport.w;
+                    record.viewport[3] = viewport.h;
+                    record.orthographic = camera.isOrthographic() ? 1 : 0;
+                },
+                [](GameObject* gameObject, const CameraRecord& record, const SceneSnapshot&) {
+                    Camera* camera = gameObject->getComponent<Camera>();
+                    if (camera == nullptr) {
+                        camera = gameObject->addComponent<Camera>();
+                    }
+                    if (camera == nullptr) {
+                        return false;
+                    }
+                    camera->setOrthographic(record.orthographic != 0);
+                    camera->setFieldOfView(Deg{record.fieldOfView});
+                    camera->setNearClipPlane(record.nearClipPlane);
+                    camera->setFarClipPlane(record.farClipPlane);
+                    camera->setUnitSize(record.unitSize);
+                    camera->setViewportRect(Rect<real>{record.viewport[0], record.viewport[1], record.viewport[2], record.viewport[3]});
+                    return true;
+                }));
+            return builtins;
+        }();
+        return registered;
+    }
+
+    const SceneSnapshot::Codec* SceneSnapshot::findCodec(const std::string& typeName) {
+        for (const Codec& codec : codecs()) {
+            if (codec.typeName == typeName) {
+                return &codec;
+            }
+        }
+        return nullptr;
+    }
+
+    bool SceneSnapshot::validate() {
+        BlobView file = mBlob.view();
+        const auto* header = file.as<SnapshotHeader>();
+        if (header != nullptr && header->magic == swappedMagic) {
+            LOG_ERROR(logger, "Scene snapshot was written on a host of the other byte order");
+            return false;
+        }
+        if (header == nullptr || header->magic != magic) {
+            LOG_ERROR(logger, "Not a scene snapshot");
+            return false;
+        }
+        if (header->version != version) {
+            LOG_ERROR(logger, "Unsupported scene snapshot version {0}, expected {1}", header->version, version);
+            return false;
+        }
+
+        auto inFile = [&file](uint64_t offset, uint64_t size) {
+            return size == 0 || (offset % snapshotAlignment == 0 && offset <= file.size() && size <= file.size() - offset);
+        };
+        if (!inFile(header->objectsOffset, uint64_t{header->objectCount} * sizeof(SnapshotObject)) ||
+            !inFile(header->transformsOffset, uint64_t{header->objectCount} * sizeof(SnapshotTransform)) ||
+            !inFile(header->sectionsOffset, uint64_t{header->sectionCount} * sizeof(SnapshotSection)) ||
+            (header->stringsSize != 0 && (header->stringsOffset > file.size() || header->stringsSize > file.size() - header->stringsOffset))) {
+            LOG_ERROR(logger, "Scene snapshot is truncated");
+            return false;
+        }
+
+        const auto* objects = reinterpret_cast<const SnapshotObject*>(file.data() + header->objectsOffset);
+        for (uint32_t i = 0; i < header->objectCount; i++) {
+            if (objects[i].parent >= static_cast<int32_t>(i)) {
+                LOG_ERROR(logger, "Scene snapshot object {0} comes before its parent", i);
+                return false;
+            }
+        }
+
+        const auto* sections = reinterpret_cast<const SnapshotSection*>(file.data() + header->sectionsOffset);
+        for (uint32_t s = 0; s < header->sectionCount; s++) {
+            const SnapshotSection& section = sections[s];
+            if (!inFile(section.objectsOffset, uint64_t{section.count} * sizeof(uint32_t)) ||
+                !inFile(section.recordsOffset, uint64_t{section.count} * section.recordSize)) {
+                LOG_ERROR(logger, "Scene snapshot is truncated");
+                return false;
+            }
+            const auto* owners = reinterpret_cast<const uint32_t*>(file.data() + section.objectsOffset);
+            for (uint32_t r = 0; r < section.count; r++) {
+                if (owners[r] >= header->objectCount) {
+                    LOG_ERROR(logger, "Scene snapshot component refers to missing object {0}", owners[r]);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}  // namespace GLaDOS
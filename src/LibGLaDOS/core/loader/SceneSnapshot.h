@@ -0,0 +1,184 @@
+#ifndef GLADOS_SCENESNAPSHOT_H
+#define GLADOS_SCENESNAPSHOT_H
+
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+#include "core/GameObject.hpp"
+#include "memory/Blob.h"
+#include "memory/BlobView.h"
+#include "resource/ResourceManager.h"
+#include "utils/Utility.h"
+
+namespace GLaDOS {
+    class Logger;
+    class Scene;
+
+    // File layout of a snapshot. Offsets count from the start of the file and every array starts 8 byte aligned,
+    // so a mapped file is read in place. Numbers are stored in the byte order of the writing host and not swapped
+    // on read, a snapshot from a host of the other byte order is rejected by open().
+    struct SnapshotString {
+        uint32_t offset;  // into the string table
+        uint32_t length;
+    };
+
+    struct SnapshotHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t objectCount;
+        int32_t mainCamera;  // object which stands for the main camera of the scene, -1 if none
+        uint32_t sectionCount;
+        uint32_t stringsSize;
+        uint64_t objectsOffset;  // SnapshotObject[objectCount], a parent always comes before its children
+        uint64_t transformsOffset;  // SnapshotTransform[objectCount]
+        uint64_t sectionsOffset;  // SnapshotSection[sectionCount]
+        uint64_t stringsOffset;
+    };
+
+    struct SnapshotObject {
+        SnapshotString name;
+        int32_t parent;  // -1 for a root
+        uint32_t active;
+    };
+
+    struct SnapshotTransform {
+        float localPosition[3];
+        float localRotation[4];  // w, x, y, z
+        float localScale[3];
+        uint32_t padding;
+    };
+
+    // all components of one type
+    struct SnapshotSection {
+        SnapshotString typeName;
+        uint32_t count;
+        uint32_t recordSize;
+        uint64_t objectsOffset;  // uint32_t[count], object of each record
+        uint64_t recordsOffset;  // count records of recordSize bytes
+    };
+
+    // Strings of a snapshot being written, equal strings are stored once.
+    class SnapshotStringTable {
+      public:
+        SnapshotString add(const std::string& value);
+        const Vector<char>& data() const;
+
+      private:
+        Vector<char> mData;
+        UnorderedMap<std::string, SnapshotString> mOffsets;
+    };
+
+    // Binary image of the game objects of a scene: names and hierarchy, local transforms, and one section
+    // of fixed size records per component type. Components are written by codecs registered per type,
+    // resources are referenced by name and looked up in the ResourceManager when the scene is instantiated.
+    class SceneSnapshot {
+      public:
+        static constexpr uint32_t magic = 0x53534C47;  // "GLSS"
+        static constexpr uint32_t version = 1;
+
+        // Record must be trivially copyable, `write` fills a zeroed record and `read` adds the component
+        template <typename T, typename Record>
+        using Writer = void (*)(T& component, Record& record, SnapshotStringTable& strings);
+        template <typename Record>
+        using Reader = bool (*)(GameObject* gameObject, const Record& record, const SceneSnapshot& snapshot);
+
+        SceneSnapshot() = default;
+
+        // objects pending destroy and components without a codec are left out
+        static bool save(Scene* scene, Blob& output);
+        static bool save(Scene* scene, const std::string& path);
+        // replaces the codec of the same type name
+        template <typename T, typename Record>
+        static void registerCodec(const std::string& typeName, Writer<T, Record> write, Reader<Record> read);
+
+        bool open(const std::string& path);  // maps the file
+        bool open(Blob blob);
+        // creates the objects in `scene`, the main camera object maps onto the camera of the scene
+        bool instantiate(Scene* scene) const;
+
+        std::size_t objectCount() const;
+        std::string string(SnapshotString value) const;
+        template <typename T>
+        T* resource(SnapshotString name, ResourceType type) const;  // nullptr for an empty name
+
+        DISALLOW_COPY_AND_ASSIGN(SceneSnapshot);
+
+      private:
+        struct Codec {
+            std::string typeName;
+            uint32_t recordSize;
+            // false if the object has no such component
+            std::function<bool(GameObject*, std::byte*, SnapshotStringTable&)> write;
+            std::function<bool(GameObject*, const std::byte*, const SceneSnapshot&)> read;
+        };
+
+        static Logger* logger;
+        template <typename T, typename Record>
+        static Codec makeCodec(const std::string& typeName, Writer<T, Record> write, Reader<Record> read);
+        static Vector<Codec>& codecs();
+        static const Codec* findCodec(const std::string& typeName);
+        bool validate();
+        template <typename T>
+        const T* arrayAt(uint64_t offset, std::size_t count) const;
+
+        Blob mBlob;
+        const SnapshotHeader* mHeader{nullptr};
+    };
+
+    template <typename T, typename Record>
+    void SceneSnapshot::registerCodec(const std::string& typeName, Writer<T, Record> write, Reader<Record> read) {
+        Codec codec = makeCodec<T, Record>(typeName, write, read);
+        Vector<Codec>& registered = codecs();
+        for (Codec& existing : registered) {
+            if (existing.typeName == typeName) {
+                existing = std::move(codec);
+                return;
+            }
+        }
+        registered.emplace_back(std::move(codec));
+    }
+
+    template <typename T, typename Record>
+    SceneSnapshot::Codec SceneSnapshot::makeCodec(const std::string& typeName, Writer<T, Record> write, Reader<Record> read) {
+        static_assert(std::is_trivially_copyable_v<Record>, "Record must be trivially copyable");
+        static_assert(alignof(Record) <= 8, "Record must not need more than 8 byte alignment");
+
+        Codec codec;
+        codec.typeName = typeName;
+        codec.recordSize = sizeof(Record);
+        codec.write = [write](GameObject* gameObject, std::byte* output, SnapshotStringTable& strings) {
+            T* component = gameObject->getComponent<T>();
+            if (component == nullptr) {
+                return false;
+            }
+            Record record{};
+            write(*component, record, strings);
+            std::memcpy(output, &record, sizeof(Record));
+            return true;
+        };
+        codec.read = [read](GameObject* gameObject, const std::byte* input, const SceneSnapshot& snapshot) {
+            return read(gameObject, *reinterpret_cast<const Record*>(input), snapshot);
+        };
+        return codec;
+    }
+
+    template <typename T>
+    T* SceneSnapshot::resource(SnapshotString name, ResourceType type) const {
+        if (name.length == 0) {
+            return nullptr;
+        }
+        return static_cast<T*>(ResourceManager::getInstance().getResource(string(name), type));
+    }
+
+    template <typename T>
+    const T* SceneSnapshot::arrayAt(uint64_t offset, std::size_t count) const {
+        if (count == 0) {
+            return nullptr;
+        }
+        return BlobView{mBlob}.subView(offset, sizeof(T) * count).as<T>();
+    }
+}  // namespace GLaDOS
+
+#endif  //GLADOS_SCENESNAPSHOT_H
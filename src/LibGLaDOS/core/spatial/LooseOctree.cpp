@@ -0,0 +1,189 @@
+#include "LooseOctree.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace GLaDOS {
+    LooseOctree::LooseOctree(const Vec3& center, real halfSize, uint32_t maxDepth, uint32_t bucketSize)
+        : mMaxDepth{std::min(maxDepth, maxDepthLimit)}, mBucketSize{std::max(bucketSize, 1u)} {
+        GASSERT(halfSize > 0);
+        mOutsideBucket = addBucket();
+        mBucketNode.push_back(npos);
+        mNodes.push_back(Node{center, halfSize, npos, addBucket(), 0});
+        mBucketNode.push_back(0);
+    }
+
+    std::size_t LooseOctree::nodeCount() const {
+        return mNodes.size();
+    }
+
+    std::size_t LooseOctree::queryRadius(const Vec3& center, real radius, GameObject** result, std::size_t capacity) const {
+        std::size_t count = 0;
+        real squaredRadius = radius * radius;
+        visitLeaves([&](const Node& node) { return squaredDistanceToLooseBounds(node, center) <= squaredRadius; },
+                    [&](const Item& item) {
+                        if (count < capacity && item.position.distanceSquare(center) <= squaredRadius) {
+                            result[count++] = item.gameObject;
+                        }
+                        return count < capacity;
+                    });
+        return count;
+    }
+
+    std::size_t LooseOctree::queryAABB(const Vec3& min, const Vec3& max, GameObject** result, std::size_t capacity) const {
+        std::size_t count = 0;
+        visitLeaves(
+            [&](const Node& node) {
+                real looseHalfSize = node.halfSize * looseness;
+                return isInside(node.center, min - looseHalfSize, max + looseHalfSize);
+            },
+            [&](const Item& item) {
+                if (count < capacity && isInside(item.position, min, max)) {
+                    result[count++] = item.gameObject;
+                }
+                return count < capacity;
+            });
+        return count;
+    }
+
+    std::size_t LooseOctree::queryNearest(const Vec3& point, std::size_t k, GameObject** result, real* distances) const {
+        std::size_t count = 0;
+        if (k == 0) {
+            return count;
+        }
+
+        for (uint32_t index : mBuckets[mOutsideBucket]) {
+            const Item& item = mItems[index];
+            count = insertNearest(item.gameObject, item.position.distance(point), k, count, result, distances);
+        }
+
+        // depth first, nearer children first, skipping nodes farther than the k-th nearest found so far
+        Array<uint32_t, maxDepthLimit * 7 + 8> stack;
+        std::size_t top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const Node& node = mNodes[stack[--top]];
+            if (count == k && squaredDistanceToLooseBounds(node, point) > distances[k - 1] * distances[k - 1]) {
+                continue;
+            }
+            if (node.firstChild == npos) {
+                for (uint32_t index : mBuckets[node.bucket]) {
+                    const Item& item = mItems[index];
+                    count = insertNearest(item.gameObject, item.position.distance(point), k, count, result, distances);
+                }
+                continue;
+            }
+
+            Array<std::pair<real, uint32_t>, 8> children;
+            for (uint32_t i = 0; i < 8; i++) {
+                uint32_t child = node.firstChild + i;
+                children[i] = {squaredDistanceToLooseBounds(mNodes[child], point), child};
+            }
+            std::sort(children.begin(), children.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+            for (const auto& child : children) {
+                stack[top++] = child.second;
+            }
+        }
+        return count;
+    }
+
+    uint32_t LooseOctree::bucketFor(const Vec3& position) {
+        if (!isInRoot(position)) {
+            return mOutsideBucket;
+        }
+        uint32_t node = 0;
+        while (mNodes[node].firstChild != npos) {
+            node = childOf(mNodes[node], position);
+        }
+        return mNodes[node].bucket;
+    }
+
+    bool LooseOctree::fits(uint32_t bucket, const Vec3& position) const {
+        uint32_t node = mBucketNode[bucket];
+        if (node == npos) {
+            return !isInRoot(position);
+        }
+        // a leaf that split has moved its objects to the children already
+        real looseHalfSize = mNodes[node].halfSize * looseness;
+        return isInside(position, mNodes[node].center - looseHalfSize, mNodes[node].center + looseHalfSize);
+    }
+
+    void LooseOctree::bucketGrown(uint32_t bucket) {
+        uint32_t node = mBucketNode[bucket];
+        if (node != npos && mBuckets[bucket].size() > mBucketSize && mNodes[node].depth < mMaxDepth) {
+            split(node);
+        }
+    }
+
+    void LooseOctree::split(uint32_t node) {
+        auto firstChild = static_cast<uint32_t>(mNodes.size());
+        Node parent = mNodes[node];
+        real halfSize = parent.halfSize / 2;
+        for (uint32_t i = 0; i < 8; i++) {
+            Vec3 offset{(i & 1) ? halfSize : -halfSize, (i & 2) ? halfSize : -halfSize, (i & 4) ? halfSize : -halfSize};
+            uint32_t bucket = addBucket();
+            mBucketNode.push_back(static_cast<uint32_t>(mNodes.size()));
+            mNodes.push_back(Node{parent.center + offset, halfSize, npos, bucket, parent.depth + 1});
+        }
+        mNodes[node].firstChild = firstChild;
+
+        // moving shrinks the bucket, so take the items from a copy. a child may split in turn,
+        // so every item looks up its leaf from the root
+        Vector<uint32_t> items = mBuckets[parent.bucket];
+        for (uint32_t index : items) {
+            moveToBucket(index, bucketFor(mItems[index].position));
+        }
+    }
+
+    uint32_t LooseOctree::childOf(const Node& node, const Vec3& position) const {
+        uint32_t child = (position.x >= node.center.x ? 1u : 0u) | (position.y >= node.center.y ? 2u : 0u) | (position.z >= node.center.z ? 4u : 0u);
+        return node.firstChild + child;
+    }
+
+    bool LooseOctree::isInRoot(const Vec3& position) const {
+        const Node& root = mNodes[0];
+        return isInside(position, root.center - root.halfSize, root.center + root.halfSize);
+    }
+
+    real LooseOctree::squaredDistanceToLooseBounds(const Node& node, const Vec3& point) {
+        real looseHalfSize = node.halfSize * looseness;
+        real squaredDistance = 0;
+        for (unsigned int axis = 0; axis < 3; axis++) {
+            real distance = std::abs(point[axis] - node.center[axis]) - looseHalfSize;
+            if (distance > 0) {
+                squaredDistance += distance * distance;
+            }
+        }
+        return squaredDistance;
+    }
+
+    template <typename Overlaps, typename Visitor>
+    void LooseOctree::visitLeaves(Overlaps&& overlaps, Visitor&& visitor) const {
+        for (uint32_t index : mBuckets[mOutsideBucket]) {
+            if (!visitor(mItems[index])) {
+                return;
+            }
+        }
+
+        Array<uint32_t, maxDepthLimit * 7 + 8> stack;
+        std::size_t top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const Node& node = mNodes[stack[--top]];
+            if (!overlaps(node)) {
+                continue;
+            }
+            if (node.firstChild == npos) {
+                for (uint32_t index : mBuckets[node.bucket]) {
+                    if (!visitor(mItems[index])) {
+                        return;
+                    }
+                }
+                continue;
+            }
+            for (uint32_t i = 0; i < 8; i++) {
+                stack[top++] = node.firstChild + i;
+            }
+        }
+    }
+}  // namespace GLaDOS
@@ -0,0 +1,56 @@
+#ifndef GLADOS_LOOSEOCTREE_H
+#define GLADOS_LOOSEOCTREE_H
+
+#include "SpatialIndex.h"
+
+namespace GLaDOS {
+    // Octree over a cube of the world whose leaves split once they hold more than `bucketSize` objects, so it
+    // adapts to uneven densities of open worlds. Every node accepts objects within twice its size, an object
+    // moving a little keeps its leaf instead of being reinserted. Objects outside of the cube are kept in a list
+    // which every query scans.
+    class LooseOctree : public SpatialIndex {
+      public:
+        static constexpr uint32_t maxDepthLimit = 16;
+
+        LooseOctree(const Vec3& center, real halfSize, uint32_t maxDepth = 8, uint32_t bucketSize = 16);
+        ~LooseOctree() override = default;
+
+        std::size_t nodeCount() const;
+
+        std::size_t queryRadius(const Vec3& center, real radius, GameObject** result, std::size_t capacity) const override;
+        std::size_t queryAABB(const Vec3& min, const Vec3& max, GameObject** result, std::size_t capacity) const override;
+        std::size_t queryNearest(const Vec3& point, std::size_t k, GameObject** result, real* distances) const override;
+
+      protected:
+        uint32_t bucketFor(const Vec3& position) override;
+        bool fits(uint32_t bucket, const Vec3& position) const override;
+        void bucketGrown(uint32_t bucket) override;
+
+      private:
+        static constexpr real looseness = 2;
+
+        struct Node {
+            Vec3 center;
+            real halfSize;
+            uint32_t firstChild;  // the 8 children are stored in a row, npos for a leaf
+            uint32_t bucket;
+            uint32_t depth;
+        };
+
+        void split(uint32_t node);
+        uint32_t childOf(const Node& node, const Vec3& position) const;
+        bool isInRoot(const Vec3& position) const;
+        static real squaredDistanceToLooseBounds(const Node& node, const Vec3& point);
+        // visits the outside list, then the leaves whose loose bounds `overlaps` accepts
+        template <typename Overlaps, typename Visitor>
+        void visitLeaves(Overlaps&& overlaps, Visitor&& visitor) const;
+
+        Vector<Node> mNodes;
+        Vector<uint32_t> mBucketNode;  // node of a bucket, npos for the outside list
+        uint32_t mOutsideBucket;
+        uint32_t mMaxDepth;
+        uint32_t mBucketSize;
+    };
+}  // namespace GLaDOS
+
+#endif  //GLADOS_LOOSEOCTREE_H
@@ -0,0 +1,190 @@
+#include "SpatialHash.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace GLaDOS {
+    SpatialHash::SpatialHash(real cellSize) : mCellSize{cellSize}, mInverseCellSize{real(1) / cellSize} {
+        GASSERT(cellSize > 0);
+    }
+
+    real SpatialHash::cellSize() const {
+        return mCellSize;
+    }
+
+    std::size_t SpatialHash::cellCount() const {
+        return mCells.size();
+    }
+
+    std::size_t SpatialHash::queryRadius(const Vec3& center, real radius, GameObject** result, std::size_t capacity) const {
+        std::size_t count = 0;
+        real squaredRadius = radius * radius;
+        visitCells(cellOf(center - radius), cellOf(center + radius), [&](const Item& item) {
+            if (count < capacity && item.position.distanceSquare(center) <= squaredRadius) {
+                result[count++] = item.gameObject;
+            }
+            return count < capacity;
+        });
+        return count;
+    }
+
+    std::size_t SpatialHash::queryAABB(const Vec3& min, const Vec3& max, GameObject** result, std::size_t capacity) const {
+        std::size_t count = 0;
+        visitCells(cellOf(min), cellOf(max), [&](const Item& item) {
+            if (count < capacity && isInside(item.position, min, max)) {
+                result[count++] = item.gameObject;
+            }
+            return count < capacity;
+        });
+        return count;
+    }
+
+    std::size_t SpatialHash::queryNearest(const Vec3& point, std::size_t k, GameObject** result, real* distances) const {
+        std::size_t count = 0;
+        if (k == 0 || mItems.empty()) {
+            return count;
+        }
+
+        auto visit = [&](const Vector<uint32_t>& items) {
+            for (uint32_t index : items) {
+                const Item& item = mItems[index];
+                count = insertNearest(item.gameObject, item.position.distance(point), k, count, result, distances);
+            }
+        };
+
+        // shells of cells around the cell of the point, ring r holds the cells r steps away on the farthest axis
+        Cell center = cellOf(point);
+        for (int32_t ring = 0;; ring++) {
+            Cell min{center.x - ring, center.y - ring, center.z - ring};
+            Cell max{center.x + ring, center.y + ring, center.z + ring};
+            bool coversAll = min.x <= mMinCell.x && min.y <= mMinCell.y && min.z <= mMinCell.z &&
+                             max.x >= mMaxCell.x && max.y >= mMaxCell.y && max.z >= mMaxCell.z;
+            auto side = static_cast<std::size_t>(2 * ring + 1);
+            if (side * side * side > mCells.size() * 8) {
+                // the shells got sparse, a linear pass is cheaper
+                count = 0;
+                for (const Item& item : mItems) {
+                    count = insertNearest(item.gameObject, item.position.distance(point), k, count, result, distances);
+                }
+                return count;
+            }
+
+            for (int32_t x = std::max(min.x, mMinCell.x); x <= std::min(max.x, mMaxCell.x); x++) {
+                for (int32_t y = std::max(min.y, mMinCell.y); y <= std::min(max.y, mMaxCell.y); y++) {
+                    bool onShell = x == min.x || x == max.x || y == min.y || y == max.y;
+                    for (int32_t z = std::max(min.z, mMinCell.z); z <= std::min(max.z, mMaxCell.z); z++) {
+                        if (!onShell && z != min.z && z != max.z) {
+                            // inner cells were visited by a smaller ring, jump to the far side
+                            z = max.z - 1;
+                            continue;
+                        }
+                        if (const Vector<uint32_t>* items = itemsIn(x, y, z); items != nullptr) {
+                            visit(*items);
+                        }
+                    }
+                }
+            }
+
+            // cells beyond this ring are at least `ring` cells away from the point
+            if (coversAll || (count == k && distances[k - 1] <= static_cast<real>(ring) * mCellSize)) {
+                return count;
+            }
+        }
+    }
+
+    uint32_t SpatialHash::bucketFor(const Vec3& position) {
+        Cell cell = cellOf(position);
+        uint64_t key = keyOf(cell);
+        auto found = mCells.find(key);
+        if (found != mCells.end()) {
+            return found->second;
+        }
+
+        uint32_t bucket;
+        if (!mFreeBuckets.empty()) {
+            bucket = mFreeBuckets.back();
+            mFreeBuckets.pop_back();
+            mBucketKeys[bucket] = key;
+        } else {
+            bucket = addBucket();
+            mBucketKeys.push_back(key);
+        }
+        mCells.emplace(key, bucket);
+
+        if (!mHasBounds) {
+            mMinCell = cell;
+            mMaxCell = cell;
+            mHasBounds = true;
+        }
+        mMinCell = Cell{std::min(mMinCell.x, cell.x), std::min(mMinCell.y, cell.y), std::min(mMinCell.z, cell.z)};
+        mMaxCell = Cell{std::max(mMaxCell.x, cell.x), std::max(mMaxCell.y, cell.y), std::max(mMaxCell.z, cell.z)};
+        return bucket;
+    }
+
+    bool SpatialHash::fits(uint32_t bucket, const Vec3& position) const {
+        return mBucketKeys[bucket] == keyOf(cellOf(position));
+    }
+
+    void SpatialHash::bucketEmptied(uint32_t bucket) {
+        mCells.erase(mBucketKeys[bucket]);
+        mFreeBuckets.push_back(bucket);
+    }
+
+    SpatialHash::Cell SpatialHash::cellOf(const Vec3& position) const {
+        return Cell{static_cast<int32_t>(std::floor(position.x * mInverseCellSize)),
+                    static_cast<int32_t>(std::floor(position.y * mInverseCellSize)),
+                    static_cast<int32_t>(std::floor(position.z * mInverseCellSize))};
+    }
+
+    uint64_t SpatialHash::keyOf(const Cell& cell) {
+        // 21 bits per axis, cells farther than a million cells from the origin wrap around and share a key,
+        // which costs a few extra distance checks but never a wrong result
+        constexpr uint64_t mask = (uint64_t(1) << 21) - 1;
+        return ((static_cast<uint64_t>(cell.x) & mask) << 42) | ((static_cast<uint64_t>(cell.y) & mask) << 21) |
+               (static_cast<uint64_t>(cell.z) & mask);
+    }
+
+    const Vector<uint32_t>* SpatialHash::itemsIn(int32_t x, int32_t y, int32_t z) const {
+        auto found = mCells.find(keyOf(Cell{x, y, z}));
+        if (found == mCells.end()) {
+            return nullptr;
+        }
+        return &mBuckets[found->second];
+    }
+
+    template <typename Visitor>
+    void SpatialHash::visitCells(const Cell& min, const Cell& max, Visitor&& visitor) const {
+        Cell from{std::max(min.x, mMinCell.x), std::max(min.y, mMinCell.y), std::max(min.z, mMinCell.z)};
+        Cell to{std::min(max.x, mMaxCell.x), std::min(max.y, mMaxCell.y), std::min(max.z, mMaxCell.z)};
+        if (from.x > to.x || from.y > to.y || from.z > to.z) {
+            return;
+        }
+
+        auto cellCount = static_cast<std::size_t>(to.x - from.x + 1) * static_cast<std::size_t>(to.y - from.y + 1) *
+                         static_cast<std::size_t>(to.z - from.z + 1);
+        if (cellCount > mItems.size()) {
+            for (const Item& item : mItems) {
+                if (!visitor(item)) {
+                    return;
+                }
+            }
+            return;
+        }
+
+        for (int32_t x = from.x; x <= to.x; x++) {
+            for (int32_t y = from.y; y <= to.y; y++) {
+                for (int32_t z = from.z; z <= to.z; z++) {
+                    const Vector<uint32_t>* items = itemsIn(x, y, z);
+                    if (items == nullptr) {
+                        continue;
+                    }
+                    for (uint32_t index : *items) {
+                        if (!visitor(mItems[index])) {
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}  // namespace GLaDOS
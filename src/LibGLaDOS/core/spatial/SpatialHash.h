@@ -0,0 +1,49 @@
+#ifndef GLADOS_SPATIALHASH_H
+#define GLADOS_SPATIALHASH_H
+
+#include "SpatialIndex.h"
+
+namespace GLaDOS {
+    // Uniform grid of cubic cells stored sparsely in a hash map, only occupied cells take memory.
+    // Suits objects spread evenly at a density known up front, pick a cell size about the usual query radius.
+    class SpatialHash : public SpatialIndex {
+      public:
+        explicit SpatialHash(real cellSize);
+        ~SpatialHash() override = default;
+
+        real cellSize() const;
+        std::size_t cellCount() const;  // occupied cells
+
+        std::size_t queryRadius(const Vec3& center, real radius, GameObject** result, std::size_t capacity) const override;
+        std::size_t queryAABB(const Vec3& min, const Vec3& max, GameObject** result, std::size_t capacity) const override;
+        std::size_t queryNearest(const Vec3& point, std::size_t k, GameObject** result, real* distances) const override;
+
+      protected:
+        uint32_t bucketFor(const Vec3& position) override;
+        bool fits(uint32_t bucket, const Vec3& position) const override;
+        void bucketEmptied(uint32_t bucket) override;
+
+      private:
+        struct Cell {
+            int32_t x, y, z;
+        };
+
+        Cell cellOf(const Vec3& position) const;
+        static uint64_t keyOf(const Cell& cell);
+        const Vector<uint32_t>* itemsIn(int32_t x, int32_t y, int32_t z) const;
+        // visits the items of the cells from `min` to `max`, or every item when that is cheaper
+        template <typename Visitor>
+        void visitCells(const Cell& min, const Cell& max, Visitor&& visitor) const;
+
+        real mCellSize;
+        real mInverseCellSize;
+        UnorderedMap<uint64_t, uint32_t> mCells;  // bucket of a cell
+        Vector<uint64_t> mBucketKeys;
+        Vector<uint32_t> mFreeBuckets;
+        Cell mMinCell{0, 0, 0};  // bounds of every cell used so far, they only grow
+        Cell mMaxCell{0, 0, 0};
+        bool mHasBounds{false};
+    };
+}  // namespace GLaDOS
+
+#endif  //GLADOS_SPATIALHASH_H
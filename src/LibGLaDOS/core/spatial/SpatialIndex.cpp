@@ -0,0 +1,101 @@
+#include "SpatialIndex.h"
+
+namespace GLaDOS {
+    void SpatialIndex::update(GameObject* gameObject, const Vec3& position) {
+        auto found = mItemOf.find(gameObject);
+        if (found == mItemOf.end()) {
+            auto index = static_cast<uint32_t>(mItems.size());
+            mItems.push_back(Item{gameObject, position, npos, 0});
+            mItemOf.emplace(gameObject, index);
+            moveToBucket(index, bucketFor(position));
+            return;
+        }
+
+        Item& item = mItems[found->second];
+        item.position = position;
+        if (!fits(item.bucket, position)) {
+            moveToBucket(found->second, bucketFor(position));
+        }
+    }
+
+    void SpatialIndex::remove(GameObject* gameObject) {
+        auto found = mItemOf.find(gameObject);
+        if (found == mItemOf.end()) {
+            return;
+        }
+        uint32_t index = found->second;
+        mItemOf.erase(found);
+        unlink(index);
+
+        // swap and pop, the last item takes the slot
+        auto last = static_cast<uint32_t>(mItems.size() - 1);
+        if (index != last) {
+            Item& moved = mItems[index];
+            moved = mItems[last];
+            mBuckets[moved.bucket][moved.slot] = index;
+            mItemOf[moved.gameObject] = index;
+        }
+        mItems.pop_back();
+    }
+
+    bool SpatialIndex::contains(const GameObject* gameObject) const {
+        return mItemOf.find(gameObject) != mItemOf.end();
+    }
+
+    std::size_t SpatialIndex::size() const {
+        return mItems.size();
+    }
+
+    uint32_t SpatialIndex::addBucket() {
+        mBuckets.emplace_back();
+        return static_cast<uint32_t>(mBuckets.size() - 1);
+    }
+
+    void SpatialIndex::moveToBucket(uint32_t item, uint32_t bucket) {
+        if (mItems[item].bucket == bucket) {
+            return;
+        }
+        unlink(item);
+        Vector<uint32_t>& items = mBuckets[bucket];
+        mItems[item].bucket = bucket;
+        mItems[item].slot = static_cast<uint32_t>(items.size());
+        items.push_back(item);
+        bucketGrown(bucket);
+    }
+
+    std::size_t SpatialIndex::insertNearest(GameObject* gameObject, real distance, std::size_t k, std::size_t count, GameObject** result, real* distances) {
+        if (count == k && distance >= distances[k - 1]) {
+            return count;
+        }
+        std::size_t index = count < k ? count++ : k - 1;
+        for (; index > 0 && distances[index - 1] > distance; index--) {
+            result[index] = result[index - 1];
+            distances[index] = distances[index - 1];
+        }
+        result[index] = gameObject;
+        distances[index] = distance;
+        return count;
+    }
+
+    bool SpatialIndex::isInside(const Vec3& position, const Vec3& min, const Vec3& max) {
+        return position.x >= min.x && position.y >= min.y && position.z >= min.z &&
+               position.x <= max.x && position.y <= max.y && position.z <= max.z;
+    }
+
+    void SpatialIndex::unlink(uint32_t item) {
+        uint32_t bucket = mItems[item].bucket;
+        if (bucket == npos) {
+            return;
+        }
+
+        Vector<uint32_t>& items = mBuckets[bucket];
+        uint32_t slot = mItems[item].slot;
+        items[slot] = items.back();
+        mItems[items[slot]].slot = slot;
+        items.pop_back();
+        mItems[item].bucket = npos;
+        if (items.empty()) {
+            bucketEmptied(bucket);
+        }
+    }
+}  // namespace GLaDOS
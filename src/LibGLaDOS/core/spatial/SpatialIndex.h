@@ -0,0 +1,66 @@
+#ifndef GLADOS_SPATIALINDEX_H
+#define GLADOS_SPATIALINDEX_H
+
+#include <cstdint>
+
+#include "math/Vec3.h"
+#include "utils/Utility.h"
+
+namespace GLaDOS {
+    class GameObject;
+    // Positions of game objects grouped into buckets so proximity queries visit only the buckets near them.
+    // Subclasses decide how space maps onto buckets, see SpatialHash and LooseOctree.
+    // Queries are const and may run concurrently, changes need exclusive access.
+    class SpatialIndex {
+      public:
+        SpatialIndex() = default;
+        virtual ~SpatialIndex() = default;
+
+        // inserts the object, or moves it if it is indexed already
+        void update(GameObject* gameObject, const Vec3& position);
+        void remove(GameObject* gameObject);
+        bool contains(const GameObject* gameObject) const;
+        std::size_t size() const;
+
+        // Queries write at most `capacity` objects to `result` and return how many were written.
+        virtual std::size_t queryRadius(const Vec3& center, real radius, GameObject** result, std::size_t capacity) const = 0;
+        virtual std::size_t queryAABB(const Vec3& min, const Vec3& max, GameObject** result, std::size_t capacity) const = 0;
+        // k nearest objects, nearest first, with their distances in `distances`
+        virtual std::size_t queryNearest(const Vec3& point, std::size_t k, GameObject** result, real* distances) const = 0;
+
+        DISALLOW_COPY_AND_ASSIGN(SpatialIndex);
+
+      protected:
+        static constexpr uint32_t npos = UINT32_MAX;  // no bucket, no node
+
+        struct Item {
+            GameObject* gameObject;
+            Vec3 position;
+            uint32_t bucket;  // npos while in no bucket
+            uint32_t slot;  // in the bucket
+        };
+
+        // bucket an object at `position` goes to, may create it with addBucket()
+        virtual uint32_t bucketFor(const Vec3& position) = 0;
+        // the object may stay in `bucket` after moving to `position`
+        virtual bool fits(uint32_t bucket, const Vec3& position) const = 0;
+        virtual void bucketGrown([[maybe_unused]] uint32_t bucket) {}
+        virtual void bucketEmptied([[maybe_unused]] uint32_t bucket) {}
+
+        uint32_t addBucket();
+        void moveToBucket(uint32_t item, uint32_t bucket);
+        // adds a candidate to the `count` nearest found so far (kept ascending), returns the new count
+        static std::size_t insertNearest(GameObject* gameObject, real distance, std::size_t k, std::size_t count, GameObject** result, real* distances);
+        static bool isInside(const Vec3& position, const Vec3& min, const Vec3& max);
+
+        Vector<Item> mItems;
+        Vector<Vector<uint32_t>> mBuckets;  // item indices
+
+      private:
+        void unlink(uint32_t item);
+
+        UnorderedMap<const GameObject*, uint32_t> mItemOf;
+    };
+}  // namespace GLaDOS
+
+#endif  //GLADOS_SPATIALINDEX_H
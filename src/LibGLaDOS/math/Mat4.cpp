@@ -0,0 +1,293 @@
+#include "Mat4.hpp"
+
+#include <cstring>
+
+#if defined(PLATFORM_SIMD_SSE2)
+#include <xmmintrin.h>
+#elif defined(PLATFORM_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace GLaDOS {
+    namespace {
+#if defined(PLATFORM_SIMD_SSE2)
+        template <int x, int y, int z, int w>
+        inline __m128 swizzle(__m128 v) {
+            return _mm_shuffle_ps(v, v, _MM_SHUFFLE(w, z, y, x));
+        }
+
+        // x and y from a, z and w from b
+        template <int x, int y, int z, int w>
+        inline __m128 shuffle(__m128 a, __m128 b) {
+            return _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x));
+        }
+
+        // row `a` times the matrix of rows b0..b3, summed in the order of the scalar loop
+        inline __m128 combineRows(__m128 a, __m128 b0, __m128 b1, __m128 b2, __m128 b3) {
+            __m128 result = _mm_mul_ps(swizzle<0, 0, 0, 0>(a), b0);
+            result = _mm_add_ps(result, _mm_mul_ps(swizzle<1, 1, 1, 1>(a), b1));
+            result = _mm_add_ps(result, _mm_mul_ps(swizzle<2, 2, 2, 2>(a), b2));
+            return _mm_add_ps(result, _mm_mul_ps(swizzle<3, 3, 3, 3>(a), b3));
+        }
+
+        // lanes w of a and b are kept, so the w of the cross product is 0
+        inline __m128 cross(__m128 a, __m128 b) {
+            return _mm_sub_ps(_mm_mul_ps(swizzle<1, 2, 0, 3>(a), swizzle<2, 0, 1, 3>(b)),
+                              _mm_mul_ps(swizzle<2, 0, 1, 3>(a), swizzle<1, 2, 0, 3>(b)));
+        }
+
+        // 2x2 row major matrices packed in a vector: a * b, adj(a) * b and a * adj(b)
+        inline __m128 mat2Mul(__m128 a, __m128 b) {
+            return _mm_add_ps(_mm_mul_ps(a, swizzle<0, 3, 0, 3>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+        }
+
+        inline __m128 mat2AdjMul(__m128 a, __m128 b) {
+            return _mm_sub_ps(_mm_mul_ps(swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(swizzle<1, 1, 2, 2>(a), swizzle<2, 3, 0, 1>(b)));
+        }
+
+        inline __m128 mat2MulAdj(__m128 a, __m128 b) {
+            return _mm_sub_ps(_mm_mul_ps(a, swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+        }
+#else
+        // Laplace expansion over 2x2 sub determinants of the upper and lower two rows, false if singular
+        bool inverseScalar(const float* a, float* out) {
+            float s0 = a[0] * a[5] - a[4] * a[1];
+            float s1 = a[0] * a[6] - a[4] * a[2];
+            float s2 = a[0] * a[7] - a[4] * a[3];
+            float s3 = a[1] * a[6] - a[5] * a[2];
+            float s4 = a[1] * a[7] - a[5] * a[3];
+            float s5 = a[2] * a[7] - a[6] * a[3];
+            float c0 = a[8] * a[13] - a[12] * a[9];
+            float c1 = a[8] * a[14] - a[12] * a[10];
+            float c2 = a[8] * a[15] - a[12] * a[11];
+            float c3 = a[9] * a[14] - a[13] * a[10];
+            float c4 = a[9] * a[15] - a[13] * a[11];
+            float c5 = a[10] * a[15] - a[14] * a[11];
+            float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            if (determinant == 0.f) {
+                return false;
+            }
+            float inverseDeterminant = 1.f / determinant;
+
+            out[0] = (a[5] * c5 - a[6] * c4 + a[7] * c3) * inverseDeterminant;
+            out[1] = (-a[1] * c5 + a[2] * c4 - a[3] * c3) * inverseDeterminant;
+            out[2] = (a[13] * s5 - a[14] * s4 + a[15] * s3) * inverseDeterminant;
+            out[3] = (-a[9] * s5 + a[10] * s4 - a[11] * s3) * inverseDeterminant;
+            out[4] = (-a[4] * c5 + a[6] * c2 - a[7] * c1) * inverseDeterminant;
+            out[5] = (a[0] * c5 - a[2] * c2 + a[3] * c1) * inverseDeterminant;
+            out[6] = (-a[12] * s5 + a[14] * s2 - a[15] * s1) * inverseDeterminant;
+            out[7] = (a[8] * s5 - a[10] * s2 + a[11] * s1) * inverseDeterminant;
+            out[8] = (a[4] * c4 - a[5] * c2 + a[7] * c0) * inverseDeterminant;
+            out[9] = (-a[0] * c4 + a[1] * c2 - a[3] * c0) * inverseDeterminant;
+            out[10] = (a[12] * s4 - a[13] * s2 + a[15] * s0) * inverseDeterminant;
+            out[11] = (-a[8] * s4 + a[9] * s2 - a[11] * s0) * inverseDeterminant;
+            out[12] = (-a[4] * c3 + a[5] * c1 - a[6] * c0) * inverseDeterminant;
+            out[13] = (a[0] * c3 - a[1] * c1 + a[2] * c0) * inverseDeterminant;
+            out[14] = (-a[12] * s3 + a[13] * s1 - a[14] * s0) * inverseDeterminant;
+            out[15] = (a[8] * s3 - a[9] * s1 + a[10] * s0) * inverseDeterminant;
+            return true;
+        }
+
+        // same as the generic Mat4<T>::inverseAffine
+        bool inverseAffineScalar(const float (&m)[4][4], float (&out)[4][4]) {
+            float c[3][3] = {
+                {m[1][1] * m[2][2] - m[1][2] * m[2][1], m[1][2] * m[2][0] - m[1][0] * m[2][2], m[1][0] * m[2][1] - m[1][1] * m[2][0]},
+                {m[2][1] * m[0][2] - m[2][2] * m[0][1], m[2][2] * m[0][0] - m[2][0] * m[0][2], m[2][0] * m[0][1] - m[2][1] * m[0][0]},
+                {m[0][1] * m[1][2] - m[0][2] * m[1][1], m[0][2] * m[1][0] - m[0][0] * m[1][2], m[0][0] * m[1][1] - m[0][1] * m[1][0]}};
+            float determinant = m[0][0] * c[0][0] + m[0][1] * c[0][1] + m[0][2] * c[0][2];
+            if (determinant == 0.f) {
+                return false;
+            }
+            determinant = 1.f / determinant;
+
+            for (int i = 0; i < 3; i++) {
+                for (int j = 0; j < 3; j++) {
+                    out[i][j] = c[j][i] * determinant;
+                }
+                out[i][3] = 0.f;
+            }
+            for (int j = 0; j < 3; j++) {
+                out[3][j] = -(m[3][0] * out[0][j] + m[3][1] * out[1][j] + m[3][2] * out[2][j]);
+            }
+            out[3][3] = 1.f;
+            return true;
+        }
+#endif
+    }  // namespace
+
+    template <>
+    Mat4<float>& Mat4<float>::operator*=(const Mat4<float>& m) {
+#if defined(PLATFORM_SIMD_SSE2)
+        // every row is read before any is written, so m may be this matrix
+        __m128 b0 = _mm_loadu_ps(m._m16);
+        __m128 b1 = _mm_loadu_ps(m._m16 + 4);
+        __m128 b2 = _mm_loadu_ps(m._m16 + 8);
+        __m128 b3 = _mm_loadu_ps(m._m16 + 12);
+        __m128 a0 = _mm_loadu_ps(_m16);
+        __m128 a1 = _mm_loadu_ps(_m16 + 4);
+        __m128 a2 = _mm_loadu_ps(_m16 + 8);
+        __m128 a3 = _mm_loadu_ps(_m16 + 12);
+        _mm_storeu_ps(_m16, combineRows(a0, b0, b1, b2, b3));
+        _mm_storeu_ps(_m16 + 4, combineRows(a1, b0, b1, b2, b3));
+        _mm_storeu_ps(_m16 + 8, combineRows(a2, b0, b1, b2, b3));
+        _mm_storeu_ps(_m16 + 12, combineRows(a3, b0, b1, b2, b3));
+#elif defined(PLATFORM_SIMD_NEON)
+        float32x4_t b0 = vld1q_f32(m._m16);
+        float32x4_t b1 = vld1q_f32(m._m16 + 4);
+        float32x4_t b2 = vld1q_f32(m._m16 + 8);
+        float32x4_t b3 = vld1q_f32(m._m16 + 12);
+        float a[16];
+        std::memcpy(a, _m16, sizeof(a));
+        for (int r = 0; r < 4; r++) {
+            float32x4_t row = vmulq_n_f32(b0, a[r * 4]);
+            row = vmlaq_n_f32(row, b1, a[r * 4 + 1]);
+            row = vmlaq_n_f32(row, b2, a[r * 4 + 2]);
+            row = vmlaq_n_f32(row, b3, a[r * 4 + 3]);
+            vst1q_f32(_m16 + r * 4, row);
+        }
+#else
+        float t[4][4];
+        for (unsigned r = 0; r < 4; r++) {
+            for (unsigned c = 0; c < 4; c++) {
+                t[r][c] = _m44[r][0] * m._m44[0][c] + _m44[r][1] * m._m44[1][c] + _m44[r][2] * m._m44[2][c] + _m44[r][3] * m._m44[3][c];
+            }
+        }
+        std::memcpy(_m44, t, sizeof(t));
+#endif
+        return *this;
+    }
+
+    template <>
+    Mat4<float> Mat4<float>::transpose(const Mat4<float>& other) {
+        Mat4<float> mat = other;
+#if defined(PLATFORM_SIMD_SSE2)
+        __m128 r0 = _mm_loadu_ps(other._m16);
+        __m128 r1 = _mm_loadu_ps(other._m16 + 4);
+        __m128 r2 = _mm_loadu_ps(other._m16 + 8);
+        __m128 r3 = _mm_loadu_ps(other._m16 + 12);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(mat._m16, r0);
+        _mm_storeu_ps(mat._m16 + 4, r1);
+        _mm_storeu_ps(mat._m16 + 8, r2);
+        _mm_storeu_ps(mat._m16 + 12, r3);
+#elif defined(PLATFORM_SIMD_NEON)
+        // the de-interleaving load reads the columns
+        float32x4x4_t columns = vld4q_f32(other._m16);
+        vst1q_f32(mat._m16, columns.val[0]);
+        vst1q_f32(mat._m16 + 4, columns.val[1]);
+        vst1q_f32(mat._m16 + 8, columns.val[2]);
+        vst1q_f32(mat._m16 + 12, columns.val[3]);
+#else
+        for (unsigned c = 0; c < 4; c++) {
+            for (unsigned r = c + 1; r < 4; r++) {
+                std::swap(mat._m44[c][r], mat._m44[r][c]);
+            }
+        }
+#endif
+        return mat;
+    }
+
+    template <>
+    Mat4<float> Mat4<float>::inverse(const Mat4<float>& other) {
+        Mat4<float> mat = other;
+#if defined(PLATFORM_SIMD_SSE2)
+        // block matrix inverse over the 2x2 blocks | A B |
+        //                                          | C D |
+        __m128 r0 = _mm_loadu_ps(other._m16);
+        __m128 r1 = _mm_loadu_ps(other._m16 + 4);
+        __m128 r2 = _mm_loadu_ps(other._m16 + 8);
+        __m128 r3 = _mm_loadu_ps(other._m16 + 12);
+        __m128 a = _mm_movelh_ps(r0, r1);
+        __m128 b = _mm_movehl_ps(r1, r0);
+        __m128 c = _mm_movelh_ps(r2, r3);
+        __m128 d = _mm_movehl_ps(r3, r2);
+
+        // (|A|, |B|, |C|, |D|)
+        __m128 subDeterminants = _mm_sub_ps(_mm_mul_ps(shuffle<0, 2, 0, 2>(r0, r2), shuffle<1, 3, 1, 3>(r1, r3)),
+                                            _mm_mul_ps(shuffle<1, 3, 1, 3>(r0, r2), shuffle<0, 2, 0, 2>(r1, r3)));
+        __m128 determinantA = swizzle<0, 0, 0, 0>(subDeterminants);
+        __m128 determinantB = swizzle<1, 1, 1, 1>(subDeterminants);
+        __m128 determinantC = swizzle<2, 2, 2, 2>(subDeterminants);
+        __m128 determinantD = swizzle<3, 3, 3, 3>(subDeterminants);
+
+        __m128 adjDC = mat2AdjMul(d, c);
+        __m128 adjAB = mat2AdjMul(a, b);
+        // adjugates of the blocks of the inverse, times |M|
+        __m128 x = _mm_sub_ps(_mm_mul_ps(determinantD, a), mat2Mul(b, adjDC));
+        __m128 w = _mm_sub_ps(_mm_mul_ps(determinantA, d), mat2Mul(c, adjAB));
+        __m128 y = _mm_sub_ps(_mm_mul_ps(determinantB, c), mat2MulAdj(d, adjAB));
+        __m128 z = _mm_sub_ps(_mm_mul_ps(determinantC, b), mat2MulAdj(a, adjDC));
+
+        // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+        __m128 trace = _mm_mul_ps(adjAB, swizzle<0, 2, 1, 3>(adjDC));
+        trace = _mm_add_ps(trace, swizzle<2, 3, 0, 1>(trace));
+        trace = _mm_add_ps(trace, swizzle<1, 0, 3, 2>(trace));
+        __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(determinantA, determinantD), _mm_mul_ps(determinantB, determinantC)), trace);
+        if (_mm_cvtss_f32(determinant) == 0.f) {
+            LOG_ERROR(logger, "Matrix determinant is zero! Inverse does not exist.");
+            return Mat4<float>::identity();
+        }
+        __m128 inverseDeterminant = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), determinant);
+        x = _mm_mul_ps(x, inverseDeterminant);
+        y = _mm_mul_ps(y, inverseDeterminant);
+        z = _mm_mul_ps(z, inverseDeterminant);
+        w = _mm_mul_ps(w, inverseDeterminant);
+
+        // the shuffles take the adjugates of the blocks and lay them out as rows
+        _mm_storeu_ps(mat._m16, shuffle<3, 1, 3, 1>(x, y));
+        _mm_storeu_ps(mat._m16 + 4, shuffle<2, 0, 2, 0>(x, y));
+        _mm_storeu_ps(mat._m16 + 8, shuffle<3, 1, 3, 1>(z, w));
+        _mm_storeu_ps(mat._m16 + 12, shuffle<2, 0, 2, 0>(z, w));
+#else
+        if (!inverseScalar(other._m16, mat._m16)) {
+            LOG_ERROR(logger, "Matrix determinant is zero! Inverse does not exist.");
+            return Mat4<float>::identity();
+        }
+#endif
+        return mat;
+    }
+
+    template <>
+    Mat4<float> Mat4<float>::inverseAffine(const Mat4<float>& other) {
+        Mat4<float> mat = other;
+#if defined(PLATFORM_SIMD_SSE2)
+        __m128 r0 = _mm_loadu_ps(other._m16);
+        __m128 r1 = _mm_loadu_ps(other._m16 + 4);
+        __m128 r2 = _mm_loadu_ps(other._m16 + 8);
+        __m128 translation = _mm_loadu_ps(other._m16 + 12);
+        // the columns of the inverse 3x3 part are cross products of its rows over the determinant
+        __m128 c0 = cross(r1, r2);
+        __m128 c1 = cross(r2, r0);
+        __m128 c2 = cross(r0, r1);
+        __m128 dot = _mm_mul_ps(r0, c0);
+        dot = _mm_add_ps(dot, swizzle<2, 3, 0, 1>(dot));
+        dot = _mm_add_ps(dot, swizzle<1, 0, 3, 2>(dot));
+        if (_mm_cvtss_f32(dot) == 0.f) {
+            LOG_ERROR(logger, "Matrix determinant is zero! Inverse does not exist.");
+            return Mat4<float>::identity();
+        }
+        __m128 inverseDeterminant = _mm_div_ps(_mm_set1_ps(1.f), dot);
+        // c0, c1 and c2 are the columns, transposing makes them rows
+        __m128 lastRow = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(c0, c1, c2, lastRow);
+        c0 = _mm_mul_ps(c0, inverseDeterminant);
+        c1 = _mm_mul_ps(c1, inverseDeterminant);
+        c2 = _mm_mul_ps(c2, inverseDeterminant);
+        // the translation row is -t * inverse(3x3), with the 1 of the last column
+        __m128 t = _mm_mul_ps(swizzle<0, 0, 0, 0>(translation), c0);
+        t = _mm_add_ps(t, _mm_mul_ps(swizzle<1, 1, 1, 1>(translation), c1));
+        t = _mm_add_ps(t, _mm_mul_ps(swizzle<2, 2, 2, 2>(translation), c2));
+        t = _mm_sub_ps(_mm_setr_ps(0.f, 0.f, 0.f, 1.f), t);
+        _mm_storeu_ps(mat._m16, c0);
+        _mm_storeu_ps(mat._m16 + 4, c1);
+        _mm_storeu_ps(mat._m16 + 8, c2);
+        _mm_storeu_ps(mat._m16 + 12, t);
+#else
+        if (!inverseAffineScalar(other._m44, mat._m44)) {
+            LOG_ERROR(logger, "Matrix determinant is zero! Inverse does not exist.");
+            return Mat4<float>::identity();
+        }
+#endif
+        return mat;
+    }
+}  // namespace GLaDOS
@@ -89,6 +89,8 @@ namespace GLaDOS {
         static T determinant(const Mat4<T>& other);
         static Mat4<T> adjugate(const Mat4<T>& other);
         static Mat4<T> inverse(const Mat4<T>& other);
+        // for matrices whose last column is (0, 0, 0, 1), like the ones of buildSRT and lookAt
+        static Mat4<T> inverseAffine(const Mat4<T>& other);
         static T inverseDeterminant(const Mat4<T>& other);
         static Mat4<T> toMat3(const Mat4<T>& other);
         static Mat4<T> abs(const Mat4<T>& other);
@@ -129,6 +131,16 @@ namespace GLaDOS {
         static void swap(Mat4& first, Mat4& second);
     };
 
+    // SSE2 and NEON versions for float, see Mat4.cpp
+    template <>
+    Mat4<float>& Mat4<float>::operator*=(const Mat4<float>& m);
+    template <>
+    Mat4<float> Mat4<float>::transpose(const Mat4<float>& other);
+    template <>
+    Mat4<float> Mat4<float>::inverse(const Mat4<float>& other);
+    template <>
+    Mat4<float> Mat4<float>::inverseAffine(const Mat4<float>& other);
+
     template <typename T>
     Logger* Mat4<T>::logger = LoggerRegistry::getInstance().makeAndGetLogger("Mat4");
 
@@ -255,7 +267,9 @@ namespace GLaDOS {
 
     template <typename T>
     Mat4<T> Mat4<T>::operator*(const Mat4<T>& m) const {
-        return Mat4(*this) *= m;
+        Mat4<T> result{*this};
+        result *= m;
+        return result;
     }
 
     template <typename T>
@@ -516,6 +530,34 @@ namespace GLaDOS {
         return Mat4<T>::adjugate(other) * determinant;
     }
 
+    template <typename T>
+    Mat4<T> Mat4<T>::inverseAffine(const Mat4<T>& other) {
+        // the columns of the inverse 3x3 part are cross products of its rows over the determinant
+        const T (&m)[4][4] = other._m44;
+        T c[3][3] = {
+            {m[1][1] * m[2][2] - m[1][2] * m[2][1], m[1][2] * m[2][0] - m[1][0] * m[2][2], m[1][0] * m[2][1] - m[1][1] * m[2][0]},
+            {m[2][1] * m[0][2] - m[2][2] * m[0][1], m[2][2] * m[0][0] - m[2][0] * m[0][2], m[2][0] * m[0][1] - m[2][1] * m[0][0]},
+            {m[0][1] * m[1][2] - m[0][2] * m[1][1], m[0][2] * m[1][0] - m[0][0] * m[1][2], m[0][0] * m[1][1] - m[0][1] * m[1][0]}};
+        T determinant = m[0][0] * c[0][0] + m[0][1] * c[0][1] + m[0][2] * c[0][2];
+        if (determinant == T(0)) {
+            LOG_ERROR(logger, "Matrix determinant is zero! Inverse does not exist.");
+            return Mat4<T>::identity();
+        }
+        determinant = T(1) / determinant;
+
+        Mat4<T> result;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                result._m44[i][j] = c[j][i] * determinant;
+            }
+        }
+        // translation moves back through the inverse rotation and scale
+        for (int j = 0; j < 3; j++) {
+            result._m44[3][j] = -(m[3][0] * result._m44[0][j] + m[3][1] * result._m44[1][j] + m[3][2] * result._m44[2][j]);
+        }
+        return result;
+    }
+
     template <typename T>
     T Mat4<T>::inverseDeterminant(const Mat4<T>& other) {
         // det(A-1) = 1 / det(A)
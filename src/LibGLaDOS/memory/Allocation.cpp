@@ -4,10 +4,72 @@
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
+#include <mutex>
 
 #include "utils/Utility.h"
 
 namespace GLaDOS {
+    static MemBlockShard _mem_shards[_mem_shard_count];
+    static MemCallSite _mem_call_sites[_mem_call_site_capacity];
+    static MemCallSite _mem_overflow_call_site{{2}, "(call site table full)", 0, "unknown"};
+    static std::atomic<uint32_t> _mem_next_shard{0};
+    static MemTagStats _mem_tag_stats[static_cast<std::size_t>(MemoryTag::TheNumberOfTag)];
+    static thread_local MemoryTag _mem_current_tag = MemoryTag::Untagged;
+
+    static uint32_t currentShardIndex() {
+        // threads are spread over shards round-robin, shards are shared only when threads outnumber them
+        static thread_local uint32_t shardIndex = _mem_next_shard.fetch_add(1, std::memory_order_relaxed) % _mem_shard_count;
+        return shardIndex;
+    }
+
+    static MemCallSite* acquireCallSite(const char* file, uint32_t line, const char* function) {
+        std::size_t hash = (reinterpret_cast<std::uintptr_t>(file) >> 3) ^ (static_cast<std::size_t>(line) * 2654435761u);
+        for (std::size_t probe = 0; probe < _mem_call_site_capacity; probe++) {
+            MemCallSite& site = _mem_call_sites[(hash + probe) & (_mem_call_site_capacity - 1)];
+            uint32_t state = site.state.load(std::memory_order_acquire);
+            if (state == 0) {
+                if (site.state.compare_exchange_strong(state, 1, std::memory_order_acquire)) {
+                    site.file = file;
+                    site.line = line;
+                    site.function = function;
+                    site.state.store(2, std::memory_order_release);
+                    return &site;
+                }
+            }
+            // another thread is registering this slot, wait until its key is visible
+            while (state != 2) {
+                state = site.state.load(std::memory_order_acquire);
+            }
+            if (site.file == file && site.line == line) {
+                return &site;
+            }
+        }
+        return &_mem_overflow_call_site;
+    }
+
+    static void accountTag(MemoryTag tag, std::size_t size) {
+        MemTagStats& stats = _mem_tag_stats[static_cast<std::size_t>(tag)];
+        std::size_t before = stats.liveBytes.fetch_add(size, std::memory_order_relaxed);
+        std::size_t after = before + size;
+        stats.liveCount.fetch_add(1, std::memory_order_relaxed);
+        stats.totalCount.fetch_add(1, std::memory_order_relaxed);
+
+        std::size_t peak = stats.peakBytes.load(std::memory_order_relaxed);
+        while (peak < after && !stats.peakBytes.compare_exchange_weak(peak, after, std::memory_order_relaxed)) {
+        }
+
+        // report only the allocation which crosses a budget, not every one above it
+        std::size_t hard = stats.hardBudget.load(std::memory_order_relaxed);
+        if (hard != 0 && before <= hard && after > hard) {
+            printf("[Memory Budget] %s exceeded hard budget: %zd / %zd bytes\n", memoryTagName(tag), after, hard);
+            return;
+        }
+        std::size_t soft = stats.softBudget.load(std::memory_order_relaxed);
+        if (soft != 0 && before <= soft && after > soft) {
+            printf("[Memory Budget] %s exceeded soft budget: %zd / %zd bytes\n", memoryTagName(tag), after, soft);
+        }
+    }
+
     std::size_t alignment(std::size_t operand, std::size_t alignment) {
         return (operand + (alignment - 1)) & ~(alignment - 1);
     }
@@ -30,7 +92,7 @@ namespace GLaDOS {
 #endif
     }
 
-    void* mmalloc(std::size_t size, const char* file, int line, const char* function) {
+    void* mmalloc(std::size_t size, const char* file, int line, const char* function, MemoryTag tag) {
         void* memory_ptr = align_malloc(size + sizeof(MemBlockDList), _mem_alignment);
         if (memory_ptr == nullptr) {
 #if MEMORY_DEBUG_PRINT == 1
@@ -47,15 +109,23 @@ namespace GLaDOS {
         memory_block->function = function;
         memory_block->prev = nullptr;
         memory_block->size = size;
+        memory_block->shard = CAST(uint16_t, currentShardIndex());
+        memory_block->tag = tag;
+        accountTag(tag, size);
+        memory_block->site = acquireCallSite(file, memory_block->line, function);
+        memory_block->site->liveBytes.fetch_add(size, std::memory_order_relaxed);
+        memory_block->site->liveCount.fetch_add(1, std::memory_order_relaxed);
+        memory_block->site->totalCount.fetch_add(1, std::memory_order_relaxed);
 
         {
-            // synchronize block
-            std::unique_lock<SpinLock> lock{_mem_spin_lock, std::try_to_lock};
-            memory_block->next = _mem_block_head;
-            if (_mem_block_head != nullptr) {
+            // only contended when another thread frees into this shard or dumpMemory() is running
+            MemBlockShard& shard = _mem_shards[memory_block->shard];
+            std::lock_guard<SpinLock> lock{shard.lock};
+            memory_block->next = shard.head;
+            if (shard.head != nullptr) {
                 memory_block->next->prev = memory_block;
             }
-            _mem_block_head = memory_block;
+            shard.head = memory_block;
         }
 
 #if MEMORY_DEBUG_PRINT == 1
@@ -77,14 +147,17 @@ namespace GLaDOS {
 #if MEMORY_DEBUG_PRINT == 1
         mprint("Freed ", memory_block);
 #endif
-        memory_block->size = ~memory_block->size;
+        memory_block->site->liveBytes.fetch_sub(memory_block->size, std::memory_order_relaxed);
+        memory_block->site->liveCount.fetch_sub(1, std::memory_order_relaxed);
+        untrackMemoryTag(memory_block->tag, memory_block->size);
 
         {
-            // synchronize block
-            std::unique_lock<SpinLock> lock{_mem_spin_lock, std::try_to_lock};
+            // block may be freed by a thread other than the allocating one, so unlink from the owner shard
+            MemBlockShard& shard = _mem_shards[memory_block->shard];
+            std::lock_guard<SpinLock> lock{shard.lock};
             if (memory_block->prev == nullptr) {
-                assert(_mem_block_head == memory_block);
-                _mem_block_head = memory_block->next;
+                assert(shard.head == memory_block);
+                shard.head = memory_block->next;
             } else {
                 memory_block->prev->next = memory_block->next;
             }
@@ -103,30 +176,121 @@ namespace GLaDOS {
 
     void dumpMemory() {
 #if MEMORY_DEBUG_PRINT_LEAK == 1
-        MemBlockDList* memory_block = _mem_block_head;
         bool leak = false;
-        while (memory_block != nullptr) {
-            if (CAST(ptrdiff_t, memory_block->size) >= 0) {
+        for (MemBlockShard& shard : _mem_shards) {
+            std::lock_guard<SpinLock> lock{shard.lock};
+            for (MemBlockDList* memory_block = shard.head; memory_block != nullptr; memory_block = memory_block->next) {
                 if (!leak) {
                     printf("[Memory Debug] Detected memory leaks!\n");
                     leak = true;
                 }
                 mprint("Leaked ", memory_block);
             }
-            memory_block = memory_block->next;
         }
 
         if (!leak) {
             printf("[Memory Debug] No memory leaks.\n");
         }
+#endif
+    }
 
-        memory_block = _mem_block_head;
-        while (memory_block != nullptr) {
-            if ((ptrdiff_t)memory_block->size < 0) {
-                mprint("Freed ", memory_block);
+    void dumpCallSites() {
+        for (std::size_t i = 0; i < callSiteCount(); i++) {
+            const MemCallSite* site = callSiteAt(i);
+            if (site == nullptr || site->liveCount.load(std::memory_order_relaxed) == 0) {
+                continue;
             }
-            memory_block = memory_block->next;
+            printf("%s: %s() (%4d): %zd blocks, %zd bytes live, %zd allocations\n", site->file, site->function, site->line,
+                   site->liveCount.load(std::memory_order_relaxed), site->liveBytes.load(std::memory_order_relaxed), site->totalCount.load(std::memory_order_relaxed));
         }
-#endif
     }
-}  // namespace GLaDOS
\ No newline at end of file
+
+    std::size_t callSiteCount() {
+        return _mem_call_site_capacity + 1;
+    }
+
+    const MemCallSite* callSiteAt(std::size_t index) {
+        if (index >= _mem_call_site_capacity) {
+            return _mem_overflow_call_site.totalCount.load(std::memory_order_relaxed) != 0 ? &_mem_overflow_call_site : nullptr;
+        }
+        const MemCallSite* site = &_mem_call_sites[index];
+        return site->state.load(std::memory_order_acquire) == 2 ? site : nullptr;
+    }
+
+    MemoryTag currentMemoryTag() {
+        return _mem_current_tag;
+    }
+
+    const char* memoryTagName(MemoryTag tag) {
+        switch (tag) {
+            case MemoryTag::Untagged:
+                return "Untagged";
+            case MemoryTag::Core:
+                return "Core";
+            case MemoryTag::Json:
+                return "Json";
+            case MemoryTag::Scene:
+                return "Scene";
+            case MemoryTag::Mesh:
+                return "Mesh";
+            case MemoryTag::Texture:
+                return "Texture";
+            case MemoryTag::Shader:
+                return "Shader";
+            case MemoryTag::Audio:
+                return "Audio";
+            default:
+                return "Unknown";
+        }
+    }
+
+    void setMemoryBudget(MemoryTag tag, std::size_t softBudget, std::size_t hardBudget) {
+        MemTagStats& stats = _mem_tag_stats[static_cast<std::size_t>(tag)];
+        stats.softBudget.store(softBudget, std::memory_order_relaxed);
+        stats.hardBudget.store(hardBudget, std::memory_order_relaxed);
+    }
+
+    MemTagUsage memoryTagUsage(MemoryTag tag) {
+        const MemTagStats& stats = _mem_tag_stats[static_cast<std::size_t>(tag)];
+        return MemTagUsage{stats.liveBytes.load(std::memory_order_relaxed), stats.peakBytes.load(std::memory_order_relaxed),
+                           stats.liveCount.load(std::memory_order_relaxed), stats.totalCount.load(std::memory_order_relaxed),
+                           stats.softBudget.load(std::memory_order_relaxed), stats.hardBudget.load(std::memory_order_relaxed)};
+    }
+
+    void trackMemoryTag(MemoryTag tag, std::size_t size) {
+        accountTag(tag, size);
+    }
+
+    void untrackMemoryTag(MemoryTag tag, std::size_t size) {
+        MemTagStats& stats = _mem_tag_stats[static_cast<std::size_t>(tag)];
+        stats.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+        stats.liveCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void resetMemoryTagPeak(MemoryTag tag) {
+        MemTagStats& stats = _mem_tag_stats[static_cast<std::size_t>(tag)];
+        stats.peakBytes.store(stats.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    void dumpMemoryTags() {
+        for (std::size_t i = 0; i < static_cast<std::size_t>(MemoryTag::TheNumberOfTag); i++) {
+            MemoryTag tag = static_cast<MemoryTag>(i);
+            MemTagUsage usage = memoryTagUsage(tag);
+            if (usage.totalCount == 0) {
+                continue;
+            }
+            printf("%-10s: %zd bytes live (peak %zd), %zd blocks, %zd allocations, budget %zd / %zd\n", memoryTagName(tag),
+                   usage.liveBytes, usage.peakBytes, usage.liveCount, usage.totalCount, usage.softBudget, usage.hardBudget);
+        }
+    }
+
+#if MEMORY_TRACE_ALLOCATION == 1
+    ScopedMemoryTag::ScopedMemoryTag(MemoryTag tag) : mPrevious{_mem_current_tag} {
+        _mem_current_tag = tag;
+    }
+
+    ScopedMemoryTag::~ScopedMemoryTag() {
+        _mem_current_tag = mPrevious;
+    }
+#endif
+}  // namespace GLaDOS
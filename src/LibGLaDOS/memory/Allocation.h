@@ -1,38 +1,133 @@
 #ifndef GLADOS_ALLOCATION_H
 #define GLADOS_ALLOCATION_H
 
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
 #include "Config.h"
 #include "utils/SpinLock.h"
 
 namespace GLaDOS {
-    struct MemBlockDList {
+    constexpr static std::size_t _mem_alignment = 0x0040;  // 64 default cache line size
+    constexpr static std::size_t _gpu_mem_alignment = 0x1000;  // 4096
+    constexpr static std::size_t _mem_page_size = 0x1000;  // 4096
+    constexpr static std::size_t _mem_shard_count = 32;
+    constexpr static std::size_t _mem_call_site_capacity = 1024;  // must be power of two
+
+    // Aggregated counters of a single MALLOC call site (file:line). Updated lock-free on every allocation.
+    struct MemCallSite {
+        std::atomic<uint32_t> state{0};  // 0 = empty, 1 = registering, 2 = ready
+        const char* file{nullptr};
+        uint32_t line{0};
+        const char* function{nullptr};
+        std::atomic<std::size_t> liveBytes{0};
+        std::atomic<std::size_t> liveCount{0};
+        std::atomic<std::size_t> totalCount{0};
+    };
+
+    // Subsystem an allocation is accounted to. Set per allocation (MALLOC_TAGGED) or per scope (ScopedMemoryTag).
+    enum class MemoryTag : uint16_t {
+        Untagged = 0,
+        Core,
+        Json,
+        Scene,
+        Mesh,
+        Texture,
+        Shader,
+        Audio,
+        TheNumberOfTag
+    };
+
+    // Live counters and budgets of a single tag. Budgets of 0 mean unlimited.
+    struct MemTagStats {
+        std::atomic<std::size_t> liveBytes{0};
+        std::atomic<std::size_t> peakBytes{0};
+        std::atomic<std::size_t> liveCount{0};
+        std::atomic<std::size_t> totalCount{0};
+        std::atomic<std::size_t> softBudget{0};
+        std::atomic<std::size_t> hardBudget{0};
+    };
+
+    // Snapshot returned by memoryTagUsage()
+    struct MemTagUsage {
+        std::size_t liveBytes;
+        std::size_t peakBytes;
+        std::size_t liveCount;
+        std::size_t totalCount;
+        std::size_t softBudget;
+        std::size_t hardBudget;
+    };
+
+    // Header in front of every MALLOC block. Padded to _mem_alignment so the payload after it stays aligned.
+    struct alignas(_mem_alignment) MemBlockDList {
         const char* file;
         uint32_t line;
+        uint16_t shard;
+        MemoryTag tag;
         const char* function;
         std::size_t size;
+        MemCallSite* site;
         MemBlockDList *next, *prev;
     };
+    static_assert(sizeof(MemBlockDList) % _mem_alignment == 0, "MALLOC payload must stay aligned to _mem_alignment");
 
-    static MemBlockDList* _mem_block_head;
-    static SpinLock _mem_spin_lock;
-    constexpr static std::size_t _mem_alignment = 0x0040;  // 64 default cache line size
-    constexpr static std::size_t _gpu_mem_alignment = 0x1000;  // 4096
+    // Each thread links its blocks into its own shard so that tracking never contends on a global lock.
+    // Shards are merged only when reporting (dumpMemory).
+    struct alignas(64) MemBlockShard {
+        SpinLock lock;
+        MemBlockDList* head{nullptr};
+    };
 
     // Aligns given value up to nearest multiply of align value. For example: alignment(11, 8) = 16.
     extern std::size_t alignment(std::size_t operand, std::size_t alignment);
     extern void* align_malloc(std::size_t size, std::size_t alignment);
     extern void align_free(void* pointer);
-    extern void* mmalloc(std::size_t size, const char* file, int line, const char* function);
+    extern void* mmalloc(std::size_t size, const char* file, int line, const char* function, MemoryTag tag);
     extern void mfree(void* ptr);
     extern void mprint(const char* reason, MemBlockDList* mi);
     extern void dumpMemory();
+    extern void dumpCallSites();
+    extern std::size_t callSiteCount();
+    extern const MemCallSite* callSiteAt(std::size_t index);  // nullptr if slot is empty
+
+    // Tag of the calling thread which MALLOC accounts to, Untagged unless a ScopedMemoryTag is alive.
+    extern MemoryTag currentMemoryTag();
+    extern const char* memoryTagName(MemoryTag tag);
+    // Logs once when live bytes of the tag cross a budget, 0 disables the check.
+    extern void setMemoryBudget(MemoryTag tag, std::size_t softBudget, std::size_t hardBudget);
+    extern MemTagUsage memoryTagUsage(MemoryTag tag);
+    // Accounts memory which does not come from MALLOC (e.g. mapped large blocks) to a tag, release with untrackMemoryTag.
+    extern void trackMemoryTag(MemoryTag tag, std::size_t size);
+    extern void untrackMemoryTag(MemoryTag tag, std::size_t size);
+    extern void resetMemoryTagPeak(MemoryTag tag);
+    extern void dumpMemoryTags();
+
+    // Accounts every MALLOC of the current thread to `tag` until the end of scope. Empty when tracing is compiled out.
+    class ScopedMemoryTag {
+      public:
+#if MEMORY_TRACE_ALLOCATION == 1
+        explicit ScopedMemoryTag(MemoryTag tag);
+        ~ScopedMemoryTag();
+#else
+        explicit ScopedMemoryTag(MemoryTag) {}
+#endif
+
+        ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+        ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+
+#if MEMORY_TRACE_ALLOCATION == 1
+      private:
+        MemoryTag mPrevious;
+#endif
+    };
 }  // namespace GLaDOS
 
 #if MEMORY_TRACE_ALLOCATION == 1
-#define MALLOC(bytes) GLaDOS::mmalloc(bytes, __FILE__, __LINE__, __FUNCTION__)
+#define MALLOC(bytes) GLaDOS::mmalloc(bytes, __FILE__, __LINE__, __FUNCTION__, GLaDOS::currentMemoryTag())
+#define MALLOC_TAGGED(bytes, tag) GLaDOS::mmalloc(bytes, __FILE__, __LINE__, __FUNCTION__, tag)
 #define FREE(ptr) GLaDOS::mfree(static_cast<void*>(ptr))
 #define NEW_T(T) new (MALLOC(sizeof(T))) T
+#define NEW_T_TAGGED(T, tag) new (MALLOC_TAGGED(sizeof(T), tag)) T
 #define DELETE_POD(ptr) \
     if (ptr) { \
         FREE(ptr); \
@@ -54,8 +149,10 @@ namespace GLaDOS {
     }
 #else
 #define MALLOC(bytes) std::malloc(bytes)
+#define MALLOC_TAGGED(bytes, tag) std::malloc(bytes)
 #define FREE(ptr) std::free(ptr)
 #define NEW_T(T) new T
+#define NEW_T_TAGGED(T, tag) new T
 #define DELETE_POD(ptr) \
     if (ptr) { \
         delete (ptr); \
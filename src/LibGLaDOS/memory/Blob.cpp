@@ -9,6 +9,8 @@
 #include "math/Point.hpp"
 #include "math/Size.hpp"
 #include "math/Rect.hpp"
+#include "memory/BlobView.h"
+#include "memory/LargeBlockAllocator.h"
 
 namespace GLaDOS {
     Logger* Blob::logger = LoggerRegistry::getInstance().makeAndGetLogger("Blob");
@@ -17,6 +19,51 @@ namespace GLaDOS {
         copyFrom(data, size);
     }
 
+    struct Blob::SharedStorage {
+        std::atomic<std::size_t> refCount{1};
+        Blob blob;
+    };
+
+    Blob::Blob(const Blob& other) {
+        if (other.mShared != nullptr) {
+            other.mShared->refCount.fetch_add(1, std::memory_order_relaxed);
+            mShared = other.mShared;
+            return;
+        }
+
+        resize(other.size());
+        if (other.size() != 0) {
+            const auto* data = static_cast<const std::byte*>(other.constPointer());
+            std::copy(data, data + other.size(), pointer());
+        }
+    }
+
+    Blob::Blob(Blob&& other) noexcept {
+        swap(*this, other);
+    }
+
+    Blob& Blob::operator=(Blob other) noexcept {
+        swap(*this, other);
+        return *this;
+    }
+
+    Blob::~Blob() {
+        releaseShared();
+        releaseMapping();
+    }
+
+    void swap(Blob& lhs, Blob& rhs) noexcept {
+        using std::swap;
+        swap(lhs.mShared, rhs.mShared);
+        swap(lhs.mData, rhs.mData);
+        swap(lhs.mMapped, rhs.mMapped);
+        swap(lhs.mMappedSize, rhs.mMappedSize);
+        swap(lhs.mMappedCapacity, rhs.mMappedCapacity);
+        swap(lhs.mMappedDirty, rhs.mMappedDirty);
+        swap(lhs.mFileMapped, rhs.mFileMapped);
+        swap(lhs.mMappedTag, rhs.mMappedTag);
+    }
+
     Blob& Blob::operator<<(int8_t value) {
         writeBytes(reinterpret_cast<std::byte*>(&value), sizeof(value));
         return *this;
@@ -134,58 +181,135 @@ namespace GLaDOS {
 
     void Blob::copyFrom(Blob& buffer) {
         throwIfOverflow(buffer.size());
-        std::copy(buffer.pointer(), buffer.pointer() + buffer.size(), pointer());
+        makeWritable();
+        const auto* data = static_cast<const std::byte*>(buffer.constPointer());
+        std::copy(data, data + buffer.size(), pointer());
     }
 
     void Blob::copyFrom(const Vector<std::byte>& data) {
         throwIfOverflow(data.size());
+        makeWritable();
         std::copy(data.data(), data.data() + data.size(), pointer());
     }
 
     void Blob::copyFrom(const std::byte* data, size_t size) {
         throwIfOverflow(size);
+        makeWritable();
         std::copy(data, data + size, pointer());
     }
 
     void Blob::copyFrom(std::size_t offset, const std::byte* data, std::size_t size) {
         throwIfOverflow(size);
+        makeWritable();
         std::copy(data, data + size, pointer() + offset);
     }
 
     void Blob::insertFrom(Blob& buffer) {
-        std::copy(buffer.pointer(), buffer.pointer() + buffer.size(), std::back_inserter(mData));
+        const auto* data = static_cast<const std::byte*>(buffer.constPointer());
+        insertFrom(data, buffer.size());
     }
 
     void Blob::insertFrom(const Vector<std::byte>& data) {
-        std::copy(data.data(), data.data() + data.size(), std::back_inserter(mData));
+        insertFrom(data.data(), data.size());
     }
 
     void Blob::insertFrom(const std::byte* data, std::size_t size) {
-        std::copy(data, data + size, std::back_inserter(mData));
+        detach();
+        if (mMapped == nullptr && mData.size() + size < LargeBlockAllocator::threshold()) {
+            std::copy(data, data + size, std::back_inserter(mData));
+            return;
+        }
+        std::size_t offset = this->size();
+        resize(offset + size);
+        std::copy(data, data + size, pointer() + offset);
+    }
+
+    bool Blob::mapFile(const std::string& path) {
+        std::size_t size = 0;
+        const std::byte* data = LargeBlockAllocator::mapFile(path, size);
+        if (data == nullptr) {
+            LOG_ERROR(logger, "Failed to map file `{0}`", path);
+            return false;
+        }
+
+        clear();
+        mMapped = const_cast<std::byte*>(data);
+        mMappedSize = size;
+        mMappedCapacity = size;
+        mMappedDirty = size;
+        mFileMapped = true;
+        return true;
+    }
+
+    void Blob::makeShared() {
+        if (mShared != nullptr) {
+            return;
+        }
+
+        // move own storage into a refcounted holder, copies then only bump the count
+        auto* shared = NEW_T(SharedStorage);
+        swap(shared->blob, *this);
+        mShared = shared;
+    }
+
+    bool Blob::isShared() const {
+        return mShared != nullptr;
+    }
+
+    std::size_t Blob::useCount() const {
+        return mShared != nullptr ? mShared->refCount.load(std::memory_order_acquire) : 1;
+    }
+
+    BlobView Blob::view() const {
+        return BlobView{*this};
     }
 
     std::byte* Blob::pointer() {
-        return mData.data();
+        // writable access may modify the bytes, so a shared or file mapped blob gets its own copy first
+        makeWritable();
+        return mMapped != nullptr ? mMapped : mData.data();
     }
 
     void const* Blob::constPointer() const {
-        return &mData.front();
+        if (mShared != nullptr) {
+            return mShared->blob.constPointer();
+        }
+        return mMapped != nullptr ? mMapped : mData.data();
     }
 
     std::size_t Blob::size() const {
-        return mData.size();
+        if (mShared != nullptr) {
+            return mShared->blob.size();
+        }
+        return mMapped != nullptr ? mMappedSize : mData.size();
     }
 
     void Blob::resize(std::size_t n) {
-        mData.resize(n);
+        detach();
+        if (mMapped == nullptr && n < LargeBlockAllocator::threshold()) {
+            mData.resize(n);
+            return;
+        }
+        makeWritable();
+        resizeMapped(n);
     }
 
     void Blob::clear() {
+        releaseShared();
+        releaseMapping();
         mData.clear();
     }
 
     bool Blob::isEmpty() const {
-        return mData.empty();
+        return size() == 0;
+    }
+
+    bool Blob::isMapped() const {
+        return mShared != nullptr ? mShared->blob.isMapped() : mMapped != nullptr;
+    }
+
+    bool Blob::isReadOnly() const {
+        return mShared != nullptr ? mShared->blob.isReadOnly() : mFileMapped;
     }
 
     void Blob::throwIfOverflow(std::size_t size) const {
@@ -202,6 +326,119 @@ namespace GLaDOS {
             return;
         }
 
+        makeWritable();
         std::copy(bytes, bytes + count, pointer());
     }
+
+    void Blob::makeWritable() {
+        detach();
+        if (!mFileMapped) {
+            return;
+        }
+
+        // copy on write: detach from the file into private memory
+        const std::byte* file = mMapped;
+        std::size_t size = mMappedSize;
+        mMapped = nullptr;
+        mMappedSize = 0;
+        mMappedCapacity = 0;
+        mMappedDirty = 0;
+        mFileMapped = false;
+        resize(size);
+        std::copy(file, file + size, pointer());
+        LargeBlockAllocator::unmapFile(file, size);
+    }
+
+    void Blob::resizeMapped(std::size_t n) {
+        if (n > mMappedCapacity) {
+            std::size_t capacity = LargeBlockAllocator::roundUp(std::max(n, mMappedCapacity * 2));
+            auto* mapped = static_cast<std::byte*>(LargeBlockAllocator::allocate(capacity));
+            if (mapped == nullptr) {
+                LOG_ERROR(logger, "Failed to map {0} bytes", capacity);
+                throw std::bad_alloc();
+            }
+
+            // new pages are already zero, only existing contents are copied
+            std::size_t size = this->size();
+            std::copy(static_cast<const std::byte*>(constPointer()), static_cast<const std::byte*>(constPointer()) + size, mapped);
+            releaseMapping();
+            Vector<std::byte>().swap(mData);
+            mMapped = mapped;
+            mMappedSize = size;
+            mMappedCapacity = capacity;
+            mMappedDirty = size;
+#if MEMORY_TRACE_ALLOCATION == 1
+            mMappedTag = currentMemoryTag();
+            trackMemoryTag(mMappedTag, capacity);
+#endif
+        }
+
+        if (n > mMappedSize) {
+            // bytes between old size and dirty mark may hold data written before a shrink
+            std::size_t dirtyEnd = std::min(n, mMappedDirty);
+            if (dirtyEnd > mMappedSize) {
+                std::fill(mMapped + mMappedSize, mMapped + dirtyEnd, std::byte{0});
+            }
+        } else {
+            // give pages past the new size back to the OS, they read as zero when touched again
+            std::size_t keep = LargeBlockAllocator::roundUp(n);
+            if (keep < mMappedCapacity) {
+                LargeBlockAllocator::decommit(mMapped + keep, mMappedCapacity - keep);
+                mMappedDirty = std::min(mMappedDirty, keep);
+            }
+        }
+        mMappedSize = n;
+        mMappedDirty = std::max(mMappedDirty, n);
+    }
+
+    void Blob::detach() {
+        if (mShared == nullptr) {
+            return;
+        }
+
+        SharedStorage* shared = mShared;
+        mShared = nullptr;
+        if (shared->refCount.load(std::memory_order_acquire) == 1) {
+            // sole owner, take the bytes back without copying
+            swap(*this, shared->blob);
+            DELETE_T(shared, SharedStorage);
+            return;
+        }
+
+        Blob copy{shared->blob};
+        swap(*this, copy);
+        mShared = shared;
+        releaseShared();
+    }
+
+    void Blob::releaseShared() {
+        if (mShared == nullptr) {
+            return;
+        }
+
+        if (mShared->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            DELETE_T(mShared, SharedStorage);
+        }
+        mShared = nullptr;
+    }
+
+    void Blob::releaseMapping() {
+        if (mMapped == nullptr) {
+            return;
+        }
+
+        if (mFileMapped) {
+            LargeBlockAllocator::unmapFile(mMapped, mMappedSize);
+        } else {
+            LargeBlockAllocator::deallocate(mMapped, mMappedCapacity);
+#if MEMORY_TRACE_ALLOCATION == 1
+            untrackMemoryTag(mMappedTag, mMappedCapacity);
+#endif
+        }
+        mMapped = nullptr;
+        mMappedSize = 0;
+        mMappedCapacity = 0;
+        mMappedDirty = 0;
+        mFileMapped = false;
+    }
 }  // namespace GLaDOS
\ No newline at end of file
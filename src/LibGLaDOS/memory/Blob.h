@@ -18,11 +18,15 @@ namespace GLaDOS {
     class Rect;
     template <typename T>
     class Mat4;
+    class BlobView;
     class Blob {
       public:
         Blob() = default;
         Blob(const std::byte* data, std::size_t size);
-        virtual ~Blob() = default;
+        Blob(const Blob& other);
+        Blob(Blob&& other) noexcept;
+        Blob& operator=(Blob other) noexcept;
+        virtual ~Blob();
 
         // all << operator behave backward emplacer.
         Blob& operator<<(int8_t value);
@@ -60,21 +64,50 @@ namespace GLaDOS {
         void insertFrom(const Vector<std::byte>& data);
         void insertFrom(const std::byte* data, std::size_t size);
 
+        // Maps the file read only instead of reading it, the blob is copied out on the first modification.
+        bool mapFile(const std::string& path);
+        // Copies of a shared blob reference the same bytes until one of them is modified (copy on write).
+        void makeShared();
+        bool isShared() const;
+        std::size_t useCount() const;
+        BlobView view() const;
+
+        // NOTE: pointer() 는 쓰기 가능한 메모리를 반환함, file mapped blob 과 shared blob 은 호출시 복사됨. 읽기만 할때는 constPointer() 사용
         std::byte* pointer();
         const void* constPointer() const;
         std::size_t size() const;
+        // buffers of LargeBlockAllocator::threshold() bytes or more move to an anonymous mapping,
+        // which the OS hands out zero filled and reclaims on shrink or clear
         void resize(std::size_t n);
         void clear();
         bool isEmpty() const;
+        bool isMapped() const;
+        bool isReadOnly() const;
+
+        friend void swap(Blob& lhs, Blob& rhs) noexcept;
 
       protected:
         void throwIfOverflow(std::size_t size) const;
 
       private:
         void writeBytes(std::byte* bytes, std::size_t count);
+        struct SharedStorage;
+
+        void makeWritable();
+        void resizeMapped(std::size_t n);
+        void releaseMapping();
+        void detach();
+        void releaseShared();
 
         static Logger* logger;
+        SharedStorage* mShared{nullptr};  // owns the bytes while the blob is shared, own storage stays empty
         Vector<std::byte> mData;
+        std::byte* mMapped{nullptr};
+        std::size_t mMappedSize{0};
+        std::size_t mMappedCapacity{0};
+        std::size_t mMappedDirty{0};  // bytes after this offset have never been written since mapped or decommitted
+        bool mFileMapped{false};
+        MemoryTag mMappedTag{MemoryTag::Untagged};  // tag the allocated mapping is accounted to, file mappings are not accounted
     };
 }  // namespace GLaDOS
 
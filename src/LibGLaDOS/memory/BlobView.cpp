@@ -0,0 +1,62 @@
+#include "BlobView.h"
+
+namespace GLaDOS {
+    Logger* BlobReader::logger = LoggerRegistry::getInstance().makeAndGetLogger("BlobReader");
+    BlobView::BlobView(const std::byte* data, std::size_t size) : mData{data}, mSize{size} {
+    }
+
+    BlobView::BlobView(const Blob& blob) : mData{static_cast<const std::byte*>(blob.constPointer())}, mSize{blob.size()} {
+    }
+
+    const std::byte* BlobView::data() const {
+        return mData;
+    }
+
+    std::size_t BlobView::size() const {
+        return mSize;
+    }
+
+    bool BlobView::isEmpty() const {
+        return mSize == 0;
+    }
+
+    BlobView BlobView::subView(std::size_t offset, std::size_t size) const {
+        if (offset >= mSize) {
+            return BlobView{};
+        }
+        return BlobView{mData + offset, std::min(size, mSize - offset)};
+    }
+
+    BlobReader::BlobReader(BlobView view) : mView{view} {
+    }
+
+    BlobView BlobReader::readBytes(std::size_t count) {
+        throwIfOverflow(count);
+        BlobView bytes = mView.subView(mCursor, count);
+        mCursor += count;
+        return bytes;
+    }
+
+    std::size_t BlobReader::position() const {
+        return mCursor;
+    }
+
+    std::size_t BlobReader::remaining() const {
+        return mView.size() - mCursor;
+    }
+
+    void BlobReader::seek(std::size_t position) {
+        mCursor = std::min(position, mView.size());
+    }
+
+    bool BlobReader::isEnd() const {
+        return mCursor == mView.size();
+    }
+
+    void BlobReader::throwIfOverflow(std::size_t size) const {
+        if (remaining() < size) {
+            LOG_ERROR(logger, "Read overflow {0} > {1}", size, remaining());
+            throw std::runtime_error("Read overflow " + std::to_string(size) + " > " + std::to_string(remaining()));
+        }
+    }
+}  // namespace GLaDOS
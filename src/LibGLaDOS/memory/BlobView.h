@@ -0,0 +1,81 @@
+#ifndef GLADOS_BLOBVIEW_H
+#define GLADOS_BLOBVIEW_H
+
+#include <cstring>
+#include <type_traits>
+
+#include "Blob.h"
+
+namespace GLaDOS {
+    // Non-owning read only window over bytes of a Blob or any other buffer.
+    // The view is invalidated when the underlying buffer is resized or destroyed.
+    class BlobView {
+      public:
+        BlobView() = default;
+        BlobView(const std::byte* data, std::size_t size);
+        BlobView(const Blob& blob);  // non-explicit intentionally
+
+        const std::byte* data() const;
+        std::size_t size() const;
+        bool isEmpty() const;
+        BlobView subView(std::size_t offset, std::size_t size) const;
+
+        template <typename T>
+        const T* as() const;
+
+      private:
+        const std::byte* mData{nullptr};
+        std::size_t mSize{0};
+    };
+
+    // Sequential typed reader over a BlobView, the counterpart of Blob::operator<<.
+    class BlobReader {
+      public:
+        explicit BlobReader(BlobView view);
+
+        template <typename T>
+        BlobReader& operator>>(T& value);
+        template <typename T>
+        T read();
+        BlobView readBytes(std::size_t count);
+
+        std::size_t position() const;
+        std::size_t remaining() const;
+        void seek(std::size_t position);
+        bool isEnd() const;
+
+      private:
+        void throwIfOverflow(std::size_t size) const;
+
+        static Logger* logger;
+        BlobView mView;
+        std::size_t mCursor{0};
+    };
+
+    template <typename T>
+    const T* BlobView::as() const {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        if (mSize < sizeof(T) || reinterpret_cast<std::uintptr_t>(mData) % alignof(T) != 0) {
+            return nullptr;
+        }
+        return reinterpret_cast<const T*>(mData);
+    }
+
+    template <typename T>
+    BlobReader& BlobReader::operator>>(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        throwIfOverflow(sizeof(T));
+        std::memcpy(&value, mView.data() + mCursor, sizeof(T));
+        mCursor += sizeof(T);
+        return *this;
+    }
+
+    template <typename T>
+    T BlobReader::read() {
+        T value;
+        *this >> value;
+        return value;
+    }
+}  // namespace GLaDOS
+
+#endif  //GLADOS_BLOBVIEW_H
@@ -1,6 +1,9 @@
 #ifndef GLADOS_FIXEDSIZEMEMORYPOOL_HPP
 #define GLADOS_FIXEDSIZEMEMORYPOOL_HPP
 
+#include <algorithm>
+#include <atomic>
+
 #include "utils/Utility.h"
 
 namespace GLaDOS {
@@ -11,57 +14,85 @@ namespace GLaDOS {
         AlignedMemBlock* next;
     };
 
+    // Pool grows by chunks of `chunkSize` blocks on demand. Blocks of a chunk are handed out lazily
+    // up to its high-water mark, so neither construction nor growth walks the whole chunk.
+    // The pool is owned by a single thread, other threads give blocks back through deallocateRemote().
     template <typename T, typename Allocator = STLAllocator<AlignedMemBlock<T>>>
     class FixedSizeMemoryPool {
       public:
         using MemBlockType = AlignedMemBlock<T>;
-        static constexpr std::size_t defaultPoolSize = ((1 << 22) / sizeof(T));
+        static constexpr std::size_t defaultChunkSize = std::max<std::size_t>(1, _mem_page_size / sizeof(MemBlockType));
 
-        FixedSizeMemoryPool(std::size_t poolSize = defaultPoolSize) noexcept;
+        FixedSizeMemoryPool(std::size_t chunkSize = defaultChunkSize) noexcept;
         ~FixedSizeMemoryPool() noexcept;
 
         template <typename... Args>
         T* allocate(Args&&... args);
         void deallocate(T* ptr);
+        // lock-free, may be called from any thread. blocks are reclaimed by the owner on its next allocate.
+        void deallocateRemote(T* ptr);
+        // returns chunks without live blocks to the allocator, returns the number of released chunks.
+        std::size_t releaseEmptyChunks();
+
+        std::size_t chunkCount() const;
+        std::size_t capacity() const;
+        std::size_t liveCount() const;
 
         DISALLOW_COPY_AND_ASSIGN(FixedSizeMemoryPool);
 
       private:
+        struct Chunk {
+            MemBlockType* blocks;
+            std::size_t highWaterMark;  // blocks [0, highWaterMark) have been handed out at least once
+        };
+
+        MemBlockType* grow();
+        void drainRemote();
+
         Allocator* mAllocator{nullptr};
         MemBlockType* mHead{nullptr};
-        MemBlockType* mData{nullptr};
-        std::size_t mSize;
+        std::atomic<MemBlockType*> mRemoteHead{nullptr};  // MPSC list of blocks freed by other threads
+        Vector<Chunk> mChunks;
+        std::size_t mChunkSize;
+        std::size_t mLiveCount{0};
     };
 
     template <typename T, typename Allocator>
-    FixedSizeMemoryPool<T, Allocator>::FixedSizeMemoryPool(std::size_t poolSize) noexcept : mSize{poolSize} {
+    FixedSizeMemoryPool<T, Allocator>::FixedSizeMemoryPool(std::size_t chunkSize) noexcept : mChunkSize{chunkSize != 0 ? chunkSize : defaultChunkSize} {
         mAllocator = NEW_T(Allocator);
-        mData = mAllocator->allocate(mSize);
-        mHead = mData;
-
-        for (std::size_t i = 0; i < mSize; i++) {
-            mData[i].next = std::addressof(mData[i + 1]);
-        }
-        mData[mSize - 1].next = nullptr;
     }
 
     template <typename T, typename Allocator>
     FixedSizeMemoryPool<T, Allocator>::~FixedSizeMemoryPool() noexcept {
-        mAllocator->deallocate(mData, mSize);
+        for (auto& chunk : mChunks) {
+            mAllocator->deallocate(chunk.blocks, mChunkSize);
+        }
+        mChunks.clear();
         DELETE_T(mAllocator, Allocator);
         mHead = nullptr;
-        mData = nullptr;
     }
 
     template <typename T, typename Allocator>
     template <typename... Args>
     T* FixedSizeMemoryPool<T, Allocator>::allocate(Args&&... args) {
         if (mHead == nullptr) {
-            return nullptr;
+            drainRemote();
         }
 
         MemBlockType* poolBlock = mHead;
-        mHead = mHead->next;
+        if (poolBlock != nullptr) {
+            mHead = mHead->next;
+        } else if (!mChunks.empty() && mChunks.back().highWaterMark < mChunkSize) {
+            // only the last chunk can have blocks which are never handed out
+            poolBlock = std::addressof(mChunks.back().blocks[mChunks.back().highWaterMark++]);
+        } else {
+            poolBlock = grow();
+            if (poolBlock == nullptr) {
+                return nullptr;
+            }
+        }
+
+        mLiveCount++;
         return new (std::addressof(poolBlock->value)) T(std::forward<Args>(args)...);
     }
 
@@ -71,6 +102,121 @@ namespace GLaDOS {
         MemBlockType* poolBlock = reinterpret_cast<MemBlockType*>(ptr);
         poolBlock->next = mHead;
         mHead = poolBlock;
+        mLiveCount--;
+    }
+
+    template <typename T, typename Allocator>
+    void FixedSizeMemoryPool<T, Allocator>::deallocateRemote(T* ptr) {
+        ptr->~T();
+        MemBlockType* poolBlock = reinterpret_cast<MemBlockType*>(ptr);
+        poolBlock->next = mRemoteHead.load(std::memory_order_relaxed);
+        while (!mRemoteHead.compare_exchange_weak(poolBlock->next, poolBlock, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    template <typename T, typename Allocator>
+    std::size_t FixedSizeMemoryPool<T, Allocator>::releaseEmptyChunks() {
+        drainRemote();
+        if (mChunks.empty()) {
+            return 0;
+        }
+
+        // count free blocks per chunk by walking the free list once, chunks are looked up by address
+        Vector<std::size_t> order(mChunks.size());
+        for (std::size_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [this](std::size_t lhs, std::size_t rhs) {
+            return mChunks[lhs].blocks < mChunks[rhs].blocks;
+        });
+        auto chunkOf = [this, &order](const MemBlockType* block) {
+            auto iter = std::upper_bound(order.begin(), order.end(), block, [this](const MemBlockType* value, std::size_t index) {
+                return value < mChunks[index].blocks;
+            });
+            return *(iter - 1);
+        };
+
+        Vector<std::size_t> freeCount(mChunks.size(), 0);
+        for (MemBlockType* block = mHead; block != nullptr; block = block->next) {
+            freeCount[chunkOf(block)]++;
+        }
+
+        Vector<bool> releasable(mChunks.size(), false);
+        std::size_t released = 0;
+        for (std::size_t i = 0; i < mChunks.size(); i++) {
+            releasable[i] = freeCount[i] == mChunks[i].highWaterMark;
+            released += releasable[i] ? 1 : 0;
+        }
+        if (released == 0) {
+            return 0;
+        }
+
+        // unlink blocks of released chunks from the free list
+        MemBlockType** link = &mHead;
+        while (*link != nullptr) {
+            if (releasable[chunkOf(*link)]) {
+                *link = (*link)->next;
+            } else {
+                link = &(*link)->next;
+            }
+        }
+
+        Vector<Chunk> remain;
+        remain.reserve(mChunks.size() - released);
+        for (std::size_t i = 0; i < mChunks.size(); i++) {
+            if (releasable[i]) {
+                mAllocator->deallocate(mChunks[i].blocks, mChunkSize);
+            } else {
+                remain.emplace_back(mChunks[i]);
+            }
+        }
+        mChunks.swap(remain);
+
+        return released;
+    }
+
+    template <typename T, typename Allocator>
+    std::size_t FixedSizeMemoryPool<T, Allocator>::chunkCount() const {
+        return mChunks.size();
+    }
+
+    template <typename T, typename Allocator>
+    std::size_t FixedSizeMemoryPool<T, Allocator>::capacity() const {
+        return mChunks.size() * mChunkSize;
+    }
+
+    template <typename T, typename Allocator>
+    std::size_t FixedSizeMemoryPool<T, Allocator>::liveCount() const {
+        return mLiveCount;
+    }
+
+    template <typename T, typename Allocator>
+    typename FixedSizeMemoryPool<T, Allocator>::MemBlockType* FixedSizeMemoryPool<T, Allocator>::grow() {
+        MemBlockType* blocks = mAllocator->allocate(mChunkSize);
+        if (blocks == nullptr) {
+            return nullptr;
+        }
+        mChunks.push_back({blocks, 1});
+        return blocks;
+    }
+
+    template <typename T, typename Allocator>
+    void FixedSizeMemoryPool<T, Allocator>::drainRemote() {
+        if (mRemoteHead.load(std::memory_order_relaxed) == nullptr) {
+            return;
+        }
+
+        // the consumer takes the whole list at once, so producers never race with a pop (no ABA)
+        MemBlockType* remote = mRemoteHead.exchange(nullptr, std::memory_order_acquire);
+        MemBlockType* tail = remote;
+        std::size_t count = 1;
+        while (tail->next != nullptr) {
+            tail = tail->next;
+            count++;
+        }
+        tail->next = mHead;
+        mHead = remote;
+        mLiveCount -= count;
     }
 }  // namespace GLaDOS
 
@@ -0,0 +1,68 @@
+#include "FrameArena.h"
+
+#include <mutex>
+
+namespace GLaDOS {
+    FrameArena::FrameArena(std::size_t capacity) : mCapacity{capacity} {
+        for (auto& buffer : mBuffers) {
+            buffer.data = static_cast<std::byte*>(align_malloc(mCapacity, _mem_alignment));
+        }
+    }
+
+    FrameArena::~FrameArena() {
+        for (auto& buffer : mBuffers) {
+            resetBuffer(buffer);
+            align_free(buffer.data);
+            buffer.data = nullptr;
+        }
+    }
+
+    void* FrameArena::allocate(std::size_t size, std::size_t align) {
+        Buffer& buffer = mBuffers[mCurrent.load(std::memory_order_relaxed)];
+        std::size_t offset = buffer.offset.load(std::memory_order_relaxed);
+        std::size_t aligned;
+        do {
+            aligned = alignment(offset, align);
+            if (aligned + size > mCapacity) {
+                return allocateOverflow(buffer, size, align);
+            }
+        } while (!buffer.offset.compare_exchange_weak(offset, aligned + size, std::memory_order_relaxed));
+
+        return buffer.data + aligned;
+    }
+
+    void FrameArena::swapBuffers() {
+        uint32_t next = mCurrent.load(std::memory_order_relaxed) ^ 1u;
+        // the buffer of the previous frame is recycled, the one just finished stays readable for one more frame
+        resetBuffer(mBuffers[next]);
+        mCurrent.store(next, std::memory_order_release);
+    }
+
+    std::size_t FrameArena::capacity() const {
+        return mCapacity;
+    }
+
+    std::size_t FrameArena::usedBytes() const {
+        return mBuffers[mCurrent.load(std::memory_order_relaxed)].offset.load(std::memory_order_relaxed);
+    }
+
+    std::size_t FrameArena::overflowCount() const {
+        const Buffer& buffer = mBuffers[mCurrent.load(std::memory_order_relaxed)];
+        return buffer.overflow.size();
+    }
+
+    void* FrameArena::allocateOverflow(Buffer& buffer, std::size_t size, std::size_t align) {
+        void* memory = align_malloc(size, std::max(align, alignof(void*)));
+        std::lock_guard<SpinLock> lock{buffer.overflowLock};
+        buffer.overflow.emplace_back(memory);
+        return memory;
+    }
+
+    void FrameArena::resetBuffer(Buffer& buffer) {
+        for (void* memory : buffer.overflow) {
+            align_free(memory);
+        }
+        buffer.overflow.clear();
+        buffer.offset.store(0, std::memory_order_relaxed);
+    }
+}  // namespace GLaDOS
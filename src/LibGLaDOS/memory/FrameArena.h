@@ -0,0 +1,79 @@
+#ifndef GLADOS_FRAMEARENA_H
+#define GLADOS_FRAMEARENA_H
+
+#include <atomic>
+#include <cstddef>
+
+#include "utils/Singleton.hpp"
+#include "utils/Utility.h"
+
+namespace GLaDOS {
+    // Double buffered linear (bump) allocator for per-frame temporaries.
+    // Memory allocated in frame N stays valid until swapBuffers() is called at the end of frame N + 1.
+    // allocate() is lock-free and may be called from any thread, swapBuffers() must not race with allocate().
+    class FrameArena : public Singleton<FrameArena> {
+      public:
+        static constexpr std::size_t defaultCapacity = 1 << 20;  // 1MB per frame
+
+        explicit FrameArena(std::size_t capacity = defaultCapacity);
+        ~FrameArena() override;
+
+        void* allocate(std::size_t size, std::size_t align = alignof(std::max_align_t));
+        void swapBuffers();
+        std::size_t capacity() const;
+        std::size_t usedBytes() const;
+        std::size_t overflowCount() const;
+
+      private:
+        struct Buffer {
+            std::byte* data{nullptr};
+            std::atomic<std::size_t> offset{0};
+            SpinLock overflowLock;
+            Vector<void*> overflow;  // allocations that did not fit in data, freed on reset
+        };
+
+        void* allocateOverflow(Buffer& buffer, std::size_t size, std::size_t align);
+        static void resetBuffer(Buffer& buffer);
+
+        std::size_t mCapacity;
+        Buffer mBuffers[2];
+        std::atomic<uint32_t> mCurrent{0};
+    };
+
+    // STL compatible adaptor that places container storage in a FrameArena, deallocate is a no-op.
+    template <typename T>
+    class FrameAllocator {
+      public:
+        template <typename U>
+        friend class FrameAllocator;
+
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        FrameAllocator() noexcept : mArena{&FrameArena::getInstance()} {}
+        explicit FrameAllocator(FrameArena& arena) noexcept : mArena{&arena} {}
+        template <class U>
+        constexpr FrameAllocator(const FrameAllocator<U>& other) noexcept : mArena{other.mArena} {}
+
+        pointer allocate(size_type count) {
+            return static_cast<pointer>(mArena->allocate(count * sizeof(value_type), alignof(value_type)));
+        }
+        void deallocate([[maybe_unused]] pointer ptr, [[maybe_unused]] size_type count) noexcept {}
+
+        template <class U>
+        bool operator==(const FrameAllocator<U>& rhs) const { return mArena == rhs.mArena; }
+        template <class U>
+        bool operator!=(const FrameAllocator<U>& rhs) const { return mArena != rhs.mArena; }
+
+      private:
+        FrameArena* mArena;
+    };
+
+    template <typename T>
+    using FrameVector = std::vector<T, FrameAllocator<T>>;
+}  // namespace GLaDOS
+
+#endif  //GLADOS_FRAMEARENA_H
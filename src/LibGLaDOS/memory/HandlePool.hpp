@@ -0,0 +1,258 @@
+#ifndef GLADOS_HANDLEPOOL_HPP
+#define GLADOS_HANDLEPOOL_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#include "utils/Singleton.hpp"
+#include "utils/Utility.h"
+
+namespace GLaDOS {
+    // 32-bit reference to an object of a HandlePool: low bits are the slot index, high bits the slot generation.
+    // A handle goes stale as soon as its object is destroyed, even if the slot is reused afterwards.
+    template <typename T>
+    class Handle {
+      public:
+        static constexpr uint32_t indexBits = 20;
+        static constexpr uint32_t generationBits = 32 - indexBits;
+        static constexpr uint32_t indexMask = (1u << indexBits) - 1;
+        static constexpr uint32_t maxGeneration = (1u << generationBits) - 1;
+
+        Handle() = default;
+        Handle(uint32_t index, uint32_t generation) : mValue{(generation << indexBits) | (index & indexMask)} {}
+
+        uint32_t index() const { return mValue & indexMask; }
+        uint32_t generation() const { return mValue >> indexBits; }
+        uint32_t value() const { return mValue; }
+        bool isNull() const { return mValue == 0; }  // generation of a live slot is never 0
+
+        bool operator==(const Handle& other) const { return mValue == other.mValue; }
+        bool operator!=(const Handle& other) const { return mValue != other.mValue; }
+
+      private:
+        uint32_t mValue{0};
+    };
+
+    // Slab pool of T addressed by generational handles. Objects live in fixed chunks, so addresses are stable
+    // and neighbours in creation order are neighbours in memory. Not thread safe, meant to be used from the main thread.
+    template <typename T>
+    class HandlePool : public Singleton<HandlePool<T>> {
+      public:
+        static constexpr uint32_t chunkBits = 8;
+        static constexpr uint32_t chunkSize = 1u << chunkBits;  // slots per chunk
+        static constexpr uint32_t maxSlotCount = Handle<T>::indexMask + 1;
+
+        HandlePool() = default;
+        ~HandlePool() override;
+
+        // returns uninitialized storage, the caller constructs T in place (or nullptr if the pool is full)
+        T* allocate();
+        // releases storage of an already destructed object
+        void deallocate(T* ptr);
+        template <typename... Args>
+        T* create(Args&&... args);
+        void destroy(T* ptr);
+        bool destroy(Handle<T> handle);
+        // allocates chunks up front so that `count` objects fit without growing
+        bool reserve(std::size_t count);
+
+        T* resolve(Handle<T> handle) const;
+        bool isValid(Handle<T> handle) const;
+        Handle<T> handleOf(const T* ptr) const;  // ptr must come from this pool
+
+        // visits live objects in slot order
+        template <typename Function>
+        void forEach(Function&& function);
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+
+        DISALLOW_COPY_AND_ASSIGN(HandlePool);
+
+      private:
+        static constexpr uint32_t npos = UINT32_MAX;
+
+        struct Slot {
+            std::aligned_storage_t<sizeof(T), alignof(T)> value;  // must stay first, see slotOf()
+            uint32_t index;
+            uint32_t generation;
+            uint32_t nextFree;
+            bool alive;
+        };
+
+        bool growChunk();
+        Slot& slotAt(uint32_t index) const;
+        static Slot* slotOf(const T* ptr);
+
+        Vector<Slot*> mChunks;
+        uint32_t mSlotCount{0};
+        uint32_t mFreeHead{npos};
+        std::size_t mLiveCount{0};
+    };
+
+    template <typename T>
+    T* resolve(Handle<T> handle) {
+        return HandlePool<T>::getInstance().resolve(handle);
+    }
+
+    template <typename T>
+    HandlePool<T>::~HandlePool() {
+        forEach([](T& object) {
+            object.~T();
+        });
+        for (Slot* chunk : mChunks) {
+            align_free(chunk);
+        }
+        mChunks.clear();
+    }
+
+    template <typename T>
+    T* HandlePool<T>::allocate() {
+        uint32_t index = mFreeHead;
+        if (index != npos) {
+            mFreeHead = slotAt(index).nextFree;
+        } else {
+            if (mSlotCount == maxSlotCount) {
+                return nullptr;
+            }
+            if (mSlotCount == capacity() && !growChunk()) {
+                return nullptr;
+            }
+            index = mSlotCount++;
+            Slot& slot = slotAt(index);
+            slot.index = index;
+            slot.generation = 1;
+        }
+
+        Slot& slot = slotAt(index);
+        slot.nextFree = npos;
+        slot.alive = true;
+        mLiveCount++;
+        return reinterpret_cast<T*>(&slot.value);
+    }
+
+    template <typename T>
+    void HandlePool<T>::deallocate(T* ptr) {
+        Slot* slot = slotOf(ptr);
+        GASSERT(slot->alive);
+        slot->alive = false;
+        mLiveCount--;
+        if (slot->generation == Handle<T>::maxGeneration) {
+            // retire the slot rather than wrap around and revive stale handles
+            return;
+        }
+        slot->generation++;
+        slot->nextFree = mFreeHead;
+        mFreeHead = slot->index;
+    }
+
+    template <typename T>
+    template <typename... Args>
+    T* HandlePool<T>::create(Args&&... args) {
+        T* ptr = allocate();
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+        return new (ptr) T(std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    void HandlePool<T>::destroy(T* ptr) {
+        if (ptr == nullptr) {
+            return;
+        }
+        ptr->~T();
+        deallocate(ptr);
+    }
+
+    template <typename T>
+    bool HandlePool<T>::destroy(Handle<T> handle) {
+        T* ptr = resolve(handle);
+        if (ptr == nullptr) {
+            return false;
+        }
+        destroy(ptr);
+        return true;
+    }
+
+    template <typename T>
+    bool HandlePool<T>::reserve(std::size_t count) {
+        count = std::min<std::size_t>(count, maxSlotCount);
+        while (capacity() < count) {
+            if (!growChunk()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    T* HandlePool<T>::resolve(Handle<T> handle) const {
+        uint32_t index = handle.index();
+        if (handle.isNull() || index >= mSlotCount) {
+            return nullptr;
+        }
+        Slot& slot = slotAt(index);
+        if (!slot.alive || slot.generation != handle.generation()) {
+            return nullptr;
+        }
+        return reinterpret_cast<T*>(&slot.value);
+    }
+
+    template <typename T>
+    bool HandlePool<T>::isValid(Handle<T> handle) const {
+        return resolve(handle) != nullptr;
+    }
+
+    template <typename T>
+    Handle<T> HandlePool<T>::handleOf(const T* ptr) const {
+        if (ptr == nullptr) {
+            return Handle<T>{};
+        }
+        const Slot* slot = slotOf(ptr);
+        return slot->alive ? Handle<T>{slot->index, slot->generation} : Handle<T>{};
+    }
+
+    template <typename T>
+    template <typename Function>
+    void HandlePool<T>::forEach(Function&& function) {
+        for (uint32_t index = 0; index < mSlotCount; index++) {
+            Slot& slot = slotAt(index);
+            if (slot.alive) {
+                function(*reinterpret_cast<T*>(&slot.value));
+            }
+        }
+    }
+
+    template <typename T>
+    std::size_t HandlePool<T>::size() const {
+        return mLiveCount;
+    }
+
+    template <typename T>
+    std::size_t HandlePool<T>::capacity() const {
+        return mChunks.size() * chunkSize;
+    }
+
+    template <typename T>
+    bool HandlePool<T>::growChunk() {
+        auto* chunk = static_cast<Slot*>(align_malloc(sizeof(Slot) * chunkSize, std::max(alignof(Slot), _mem_alignment)));
+        if (chunk == nullptr) {
+            return false;
+        }
+        mChunks.push_back(chunk);
+        return true;
+    }
+
+    template <typename T>
+    typename HandlePool<T>::Slot& HandlePool<T>::slotAt(uint32_t index) const {
+        return mChunks[index >> chunkBits][index & (chunkSize - 1)];
+    }
+
+    template <typename T>
+    typename HandlePool<T>::Slot* HandlePool<T>::slotOf(const T* ptr) {
+        return reinterpret_cast<Slot*>(const_cast<T*>(ptr));
+    }
+}  // namespace GLaDOS
+
+#endif  //GLADOS_HANDLEPOOL_HPP
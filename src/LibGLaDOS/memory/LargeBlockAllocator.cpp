@@ -0,0 +1,164 @@
+#include "LargeBlockAllocator.h"
+
+#include "platform/OSTypes.h"
+
+#ifdef PLATFORM_WINDOW
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace GLaDOS {
+    std::atomic<std::size_t> LargeBlockAllocator::mThreshold{defaultThreshold};
+    std::atomic<bool> LargeBlockAllocator::mUseHugePages{false};
+    std::atomic<std::size_t> LargeBlockAllocator::mMappedBytes{0};
+
+    void* LargeBlockAllocator::allocate(std::size_t size) {
+        if (size == 0) {
+            return nullptr;
+        }
+        std::size_t length = roundUp(size);
+#ifdef PLATFORM_WINDOW
+        void* ptr = VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+#else
+        void* ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) {
+            return nullptr;
+        }
+#if defined(PLATFORM_LINUX) && defined(MADV_HUGEPAGE)
+        if (length >= hugePageSize && useHugePages()) {
+            madvise(ptr, length, MADV_HUGEPAGE);
+        }
+#endif
+#endif
+        mMappedBytes.fetch_add(length, std::memory_order_relaxed);
+        return ptr;
+    }
+
+    void LargeBlockAllocator::deallocate(void* ptr, std::size_t size) {
+        if (ptr == nullptr) {
+            return;
+        }
+        std::size_t length = roundUp(size);
+#ifdef PLATFORM_WINDOW
+        VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+        munmap(ptr, length);
+#endif
+        mMappedBytes.fetch_sub(length, std::memory_order_relaxed);
+    }
+
+    void LargeBlockAllocator::decommit(void* ptr, std::size_t size) {
+        if (ptr == nullptr || size == 0) {
+            return;
+        }
+#ifdef PLATFORM_WINDOW
+        VirtualFree(ptr, size, MEM_DECOMMIT);
+        VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE);
+#elif defined(PLATFORM_LINUX)
+        // private anonymous pages are refilled with zero on the next touch
+        madvise(ptr, size, MADV_DONTNEED);
+#else
+        // MADV_DONTNEED keeps page contents on darwin, replace the range with fresh pages instead
+        mmap(ptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+#endif
+    }
+
+    const std::byte* LargeBlockAllocator::mapFile(const std::string& path, std::size_t& size) {
+        size = 0;
+#ifdef PLATFORM_WINDOW
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            return nullptr;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            return nullptr;
+        }
+        void* ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+        struct stat status {};
+        if (fstat(fd, &status) != 0 || status.st_size <= 0) {
+            close(fd);
+            return nullptr;
+        }
+        void* ptr = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);  // mapping keeps its own reference to the file
+        if (ptr == MAP_FAILED) {
+            return nullptr;
+        }
+        size = static_cast<std::size_t>(status.st_size);
+#endif
+        return static_cast<const std::byte*>(ptr);
+    }
+
+    void LargeBlockAllocator::unmapFile(const std::byte* ptr, std::size_t size) {
+        if (ptr == nullptr) {
+            return;
+        }
+#ifdef PLATFORM_WINDOW
+        UnmapViewOfFile(ptr);
+#else
+        munmap(const_cast<std::byte*>(ptr), size);
+#endif
+    }
+
+    std::size_t LargeBlockAllocator::pageSize() {
+#ifdef PLATFORM_WINDOW
+        static const std::size_t size = [] {
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return static_cast<std::size_t>(info.dwAllocationGranularity);
+        }();
+#else
+        static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+        return size;
+    }
+
+    std::size_t LargeBlockAllocator::roundUp(std::size_t size) {
+        std::size_t page = pageSize();
+        return (size + page - 1) / page * page;
+    }
+
+    std::size_t LargeBlockAllocator::threshold() {
+        return mThreshold.load(std::memory_order_relaxed);
+    }
+
+    void LargeBlockAllocator::setThreshold(std::size_t threshold) {
+        mThreshold.store(threshold, std::memory_order_relaxed);
+    }
+
+    bool LargeBlockAllocator::useHugePages() {
+        return mUseHugePages.load(std::memory_order_relaxed);
+    }
+
+    void LargeBlockAllocator::setUseHugePages(bool enable) {
+        mUseHugePages.store(enable, std::memory_order_relaxed);
+    }
+
+    std::size_t LargeBlockAllocator::mappedBytes() {
+        return mMappedBytes.load(std::memory_order_relaxed);
+    }
+}  // namespace GLaDOS
@@ -0,0 +1,46 @@
+#ifndef GLADOS_LARGEBLOCKALLOCATOR_H
+#define GLADOS_LARGEBLOCKALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+namespace GLaDOS {
+    // Page granular allocations straight from the OS virtual memory (mmap / VirtualAlloc).
+    // Fresh pages read as zero without being touched, and decommitted pages return to the OS at once,
+    // which suits big payloads such as vertex data and textures that malloc would zero-fill and keep resident.
+    class LargeBlockAllocator {
+      public:
+        static constexpr std::size_t defaultThreshold = 256 * 1024;
+        static constexpr std::size_t hugePageSize = 2 * 1024 * 1024;
+
+        // returns zero filled memory of roundUp(size) bytes or nullptr
+        static void* allocate(std::size_t size);
+        static void deallocate(void* ptr, std::size_t size);
+        // drops physical pages of [ptr, ptr + size), the range stays valid and reads as zero afterwards
+        static void decommit(void* ptr, std::size_t size);
+
+        // read only view of a whole file, nullptr on failure or empty file
+        static const std::byte* mapFile(const std::string& path, std::size_t& size);
+        static void unmapFile(const std::byte* ptr, std::size_t size);
+
+        static std::size_t pageSize();
+        static std::size_t roundUp(std::size_t size);
+
+        // blocks of at least threshold() bytes should be mapped rather than malloc'd
+        static std::size_t threshold();
+        static void setThreshold(std::size_t threshold);
+        // advise transparent huge pages for mappings larger than hugePageSize where supported
+        static bool useHugePages();
+        static void setUseHugePages(bool enable);
+
+        static std::size_t mappedBytes();
+
+      private:
+        static std::atomic<std::size_t> mThreshold;
+        static std::atomic<bool> mUseHugePages;
+        static std::atomic<std::size_t> mMappedBytes;
+    };
+}  // namespace GLaDOS
+
+#endif  //GLADOS_LARGEBLOCKALLOCATOR_H
@@ -0,0 +1,102 @@
+#include "MemoryResource.h"
+
+#include <algorithm>
+
+#include "SizeClassAllocator.h"
+
+namespace GLaDOS {
+    class HeapMemoryResource : public MemoryResource {
+      public:
+        void* allocate(std::size_t bytes, std::size_t align) override {
+#if STL_SIZE_CLASS_ALLOCATOR == 1
+            if (SizeClassAllocator::isSmall(bytes, align)) {
+                return SizeClassAllocator::allocate(bytes);
+            }
+#endif
+            if (align > SizeClassAllocator::granularity) {
+                return align_malloc(bytes, align);
+            }
+            return MALLOC(bytes);
+        }
+
+        void deallocate(void* ptr, [[maybe_unused]] std::size_t bytes, std::size_t align) override {
+#if STL_SIZE_CLASS_ALLOCATOR == 1
+            if (SizeClassAllocator::isSmall(bytes, align)) {
+                SizeClassAllocator::deallocate(ptr, bytes);
+                return;
+            }
+#endif
+            if (align > SizeClassAllocator::granularity) {
+                align_free(ptr);
+                return;
+            }
+            FREE(ptr);
+        }
+    };
+
+    MemoryResource* defaultMemoryResource() noexcept {
+        // never destroyed, containers may outlive static objects
+        static HeapMemoryResource* resource = new HeapMemoryResource();
+        return resource;
+    }
+
+    MonotonicArena::MonotonicArena(std::size_t initialChunkSize, MemoryResource* upstream)
+        : mUpstream{upstream}, mNextChunkSize{std::max(initialChunkSize, sizeof(Chunk) + alignof(std::max_align_t))} {
+    }
+
+    MonotonicArena::~MonotonicArena() {
+        release();
+    }
+
+    void* MonotonicArena::allocate(std::size_t bytes, std::size_t align) {
+        auto current = reinterpret_cast<std::uintptr_t>(mCursor);
+        std::uintptr_t aligned = alignment(current, align);
+        if (mCursor == nullptr || aligned + bytes > reinterpret_cast<std::uintptr_t>(mEnd)) {
+            // grow geometrically, a single oversized request gets a chunk of its own size
+            std::size_t chunkSize = std::max(mNextChunkSize, alignment(sizeof(Chunk), align) + bytes);
+            std::size_t chunkAlign = std::max(align, alignof(Chunk));
+            auto* chunk = static_cast<Chunk*>(mUpstream->allocate(chunkSize, chunkAlign));
+            if (chunk == nullptr) {
+                // the current chunk stays in use, later requests that fit in it still succeed
+                return nullptr;
+            }
+            chunk->prev = mCurrent;
+            chunk->size = chunkSize;
+            chunk->align = chunkAlign;
+            mCurrent = chunk;
+            mCursor = reinterpret_cast<std::byte*>(chunk) + sizeof(Chunk);
+            mEnd = reinterpret_cast<std::byte*>(chunk) + chunkSize;
+            mChunkCount++;
+            mNextChunkSize = std::min(mNextChunkSize * 2, maxChunkSize);
+            aligned = alignment(reinterpret_cast<std::uintptr_t>(mCursor), align);
+        }
+
+        mCursor = reinterpret_cast<std::byte*>(aligned + bytes);
+        mUsedBytes += bytes;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void MonotonicArena::deallocate([[maybe_unused]] void* ptr, [[maybe_unused]] std::size_t bytes, [[maybe_unused]] std::size_t align) {
+        // memory is reclaimed by release()
+    }
+
+    void MonotonicArena::release() {
+        while (mCurrent != nullptr) {
+            Chunk* prev = mCurrent->prev;
+            mUpstream->deallocate(mCurrent, mCurrent->size, mCurrent->align);
+            mCurrent = prev;
+        }
+        mCursor = nullptr;
+        mEnd = nullptr;
+        mChunkCount = 0;
+        mUsedBytes = 0;
+    }
+
+    std::size_t MonotonicArena::chunkCount() const {
+        return mChunkCount;
+    }
+
+    std::size_t MonotonicArena::usedBytes() const {
+        return mUsedBytes;
+    }
+}  // namespace GLaDOS
@@ -0,0 +1,107 @@
+#ifndef GLADOS_MEMORYRESOURCE_H
+#define GLADOS_MEMORYRESOURCE_H
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include "Allocation.h"
+
+namespace GLaDOS {
+    // Polymorphic source of memory for PolymorphicAllocator (a small subset of std::pmr::memory_resource).
+    class MemoryResource {
+      public:
+        MemoryResource() = default;
+        virtual ~MemoryResource() = default;
+
+        virtual void* allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t)) = 0;
+        virtual void deallocate(void* ptr, std::size_t bytes, std::size_t align = alignof(std::max_align_t)) = 0;
+        virtual bool isEqual(const MemoryResource& other) const noexcept { return this == &other; }
+    };
+
+    // Resource used when none is given, allocates like STLAllocator does.
+    extern MemoryResource* defaultMemoryResource() noexcept;
+
+    // Bump allocator over chunks taken from an upstream resource. deallocate() is a no-op,
+    // everything is given back at once by release() or when the arena goes out of scope.
+    // allocate() returns nullptr when the upstream can not provide a new chunk.
+    class MonotonicArena : public MemoryResource {
+      public:
+        static constexpr std::size_t defaultChunkSize = 4096;
+        static constexpr std::size_t maxChunkSize = 1 << 20;
+
+        explicit MonotonicArena(std::size_t initialChunkSize = defaultChunkSize, MemoryResource* upstream = defaultMemoryResource());
+        ~MonotonicArena() override;
+
+        MonotonicArena(const MonotonicArena&) = delete;
+        MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+        void* allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t)) override;
+        void deallocate(void* ptr, std::size_t bytes, std::size_t align = alignof(std::max_align_t)) override;
+        void release();
+        std::size_t chunkCount() const;
+        std::size_t usedBytes() const;
+
+      private:
+        struct Chunk {
+            Chunk* prev;
+            std::size_t size;
+            std::size_t align;  // passed back to the upstream on release
+        };
+
+        MemoryResource* mUpstream;
+        Chunk* mCurrent{nullptr};
+        std::byte* mCursor{nullptr};
+        std::byte* mEnd{nullptr};
+        std::size_t mNextChunkSize;
+        std::size_t mChunkCount{0};
+        std::size_t mUsedBytes{0};
+    };
+
+    // Stateful STL allocator which forwards to a MemoryResource. Nested containers that use
+    // the same allocator family receive it on construction (trailing allocator convention).
+    template <typename T>
+    class PolymorphicAllocator {
+      public:
+        template <typename U>
+        friend class PolymorphicAllocator;
+
+        using value_type = T;
+
+        PolymorphicAllocator() noexcept : mResource{defaultMemoryResource()} {}
+        PolymorphicAllocator(MemoryResource* resource) noexcept : mResource{resource} {}
+        template <typename U>
+        PolymorphicAllocator(const PolymorphicAllocator<U>& other) noexcept : mResource{other.mResource} {}
+        PolymorphicAllocator& operator=(const PolymorphicAllocator&) = delete;
+
+        T* allocate(std::size_t count) {
+            return static_cast<T*>(mResource->allocate(count * sizeof(T), alignof(T)));
+        }
+        void deallocate(T* ptr, std::size_t count) noexcept {
+            mResource->deallocate(ptr, count * sizeof(T), alignof(T));
+        }
+
+        template <typename U, typename... Args>
+        void construct(U* ptr, Args&&... args) {
+            if constexpr (std::uses_allocator_v<U, PolymorphicAllocator> && std::is_constructible_v<U, Args..., const PolymorphicAllocator&>) {
+                ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)..., *this);
+            } else {
+                ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+            }
+        }
+
+        // copies of a container don't inherit the arena of the source
+        PolymorphicAllocator select_on_container_copy_construction() const { return PolymorphicAllocator(); }
+        MemoryResource* resource() const { return mResource; }
+
+        template <typename U>
+        bool operator==(const PolymorphicAllocator<U>& rhs) const { return mResource->isEqual(*rhs.mResource); }
+        template <typename U>
+        bool operator!=(const PolymorphicAllocator<U>& rhs) const { return !(*this == rhs); }
+
+      private:
+        MemoryResource* mResource;
+    };
+}  // namespace GLaDOS
+
+#endif  //GLADOS_MEMORYRESOURCE_H
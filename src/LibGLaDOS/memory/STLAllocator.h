@@ -4,6 +4,7 @@
 #include <limits>
 
 #include "Allocation.h"
+#include "SizeClassAllocator.h"
 
 namespace GLaDOS {
     template <typename T>
@@ -37,11 +38,23 @@ namespace GLaDOS {
     template <typename T>
     typename STLAllocator<T>::pointer STLAllocator<T>::allocate(size_type count) {
         size_type size = count * sizeof(value_type);
+#if STL_SIZE_CLASS_ALLOCATOR == 1
+        if (SizeClassAllocator::isSmall(size, alignof(value_type))) {
+            return static_cast<pointer>(SizeClassAllocator::allocate(size));
+        }
+#endif
         return static_cast<pointer>(MALLOC(size));
     }
 
     template <typename T>
     void STLAllocator<T>::deallocate(pointer ptr, [[maybe_unused]] size_type count) noexcept {
+#if STL_SIZE_CLASS_ALLOCATOR == 1
+        size_type size = count * sizeof(value_type);
+        if (SizeClassAllocator::isSmall(size, alignof(value_type))) {
+            SizeClassAllocator::deallocate(ptr, size);
+            return;
+        }
+#endif
         FREE(ptr);
     }
 
@@ -0,0 +1,149 @@
+#include "SizeClassAllocator.h"
+
+#include <atomic>
+#include <mutex>
+
+#include "Allocation.h"
+#include "utils/SpinLock.h"
+
+namespace GLaDOS {
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct alignas(64) CentralFreeList {
+        SpinLock lock;
+        FreeBlock* head{nullptr};
+        std::byte* cursor{nullptr};  // bump region of the current slab
+        std::byte* end{nullptr};
+    };
+
+    // trivially destructible, so it stays usable while thread local and static objects are destroyed
+    struct ThreadCache {
+        FreeBlock* head[SizeClassAllocator::classCount];
+        uint32_t count[SizeClassAllocator::classCount];
+        bool released;
+    };
+
+    struct ThreadCacheReleaser {
+        ~ThreadCacheReleaser();
+    };
+
+    static CentralFreeList _central_lists[SizeClassAllocator::classCount];
+    static std::atomic<std::size_t> _slab_count{0};
+    static thread_local ThreadCache _thread_cache{};
+    static thread_local ThreadCacheReleaser _thread_cache_releaser;
+
+    static std::size_t blockSizeOf(std::size_t sizeClass) {
+        return (sizeClass + 1) * SizeClassAllocator::granularity;
+    }
+
+    // central list must be locked by caller
+    static FreeBlock* takeFromCentral(CentralFreeList& central, std::size_t sizeClass) {
+        if (central.head != nullptr) {
+            FreeBlock* block = central.head;
+            central.head = block->next;
+            return block;
+        }
+
+        std::size_t blockSize = blockSizeOf(sizeClass);
+        if (central.cursor == nullptr || central.cursor + blockSize > central.end) {
+            auto* slab = static_cast<std::byte*>(align_malloc(SizeClassAllocator::slabSize, _mem_alignment));
+            if (slab == nullptr) {
+                return nullptr;
+            }
+            _slab_count.fetch_add(1, std::memory_order_relaxed);
+            central.cursor = slab;
+            central.end = slab + SizeClassAllocator::slabSize;
+        }
+        auto* block = reinterpret_cast<FreeBlock*>(central.cursor);
+        central.cursor += blockSize;
+        return block;
+    }
+
+    static void returnToCentral(std::size_t sizeClass, FreeBlock* first, FreeBlock* last) {
+        CentralFreeList& central = _central_lists[sizeClass];
+        std::lock_guard<SpinLock> lock{central.lock};
+        last->next = central.head;
+        central.head = first;
+    }
+
+    // moves `count` blocks from the front of the thread cache to the central list
+    static void flushThreadCache(ThreadCache& cache, std::size_t sizeClass, uint32_t count) {
+        if (count == 0) {
+            return;
+        }
+        FreeBlock* first = cache.head[sizeClass];
+        FreeBlock* last = first;
+        for (uint32_t i = 1; i < count; i++) {
+            last = last->next;
+        }
+        cache.head[sizeClass] = last->next;
+        cache.count[sizeClass] -= count;
+        returnToCentral(sizeClass, first, last);
+    }
+
+    ThreadCacheReleaser::~ThreadCacheReleaser() {
+        for (std::size_t sizeClass = 0; sizeClass < SizeClassAllocator::classCount; sizeClass++) {
+            flushThreadCache(_thread_cache, sizeClass, _thread_cache.count[sizeClass]);
+        }
+        _thread_cache.released = true;
+    }
+
+    void* SizeClassAllocator::allocate(std::size_t size) {
+        std::size_t sizeClass = sizeClassOf(size);
+        ThreadCache& cache = _thread_cache;
+        if (cache.head[sizeClass] != nullptr) {
+            FreeBlock* block = cache.head[sizeClass];
+            cache.head[sizeClass] = block->next;
+            cache.count[sizeClass]--;
+            return block;
+        }
+
+        CentralFreeList& central = _central_lists[sizeClass];
+        std::lock_guard<SpinLock> lock{central.lock};
+        FreeBlock* block = takeFromCentral(central, sizeClass);
+        if (block == nullptr || cache.released) {
+            return block;
+        }
+
+        // refill thread cache so that the next allocations of this class don't touch the central list
+        static_cast<void>(_thread_cache_releaser);
+        for (uint32_t i = 0; i < transferBatch; i++) {
+            FreeBlock* extra = takeFromCentral(central, sizeClass);
+            if (extra == nullptr) {
+                break;
+            }
+            extra->next = cache.head[sizeClass];
+            cache.head[sizeClass] = extra;
+            cache.count[sizeClass]++;
+        }
+        return block;
+    }
+
+    void SizeClassAllocator::deallocate(void* ptr, std::size_t size) {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        std::size_t sizeClass = sizeClassOf(size);
+        auto* block = static_cast<FreeBlock*>(ptr);
+        ThreadCache& cache = _thread_cache;
+        if (cache.released) {
+            returnToCentral(sizeClass, block, block);
+            return;
+        }
+
+        static_cast<void>(_thread_cache_releaser);
+        block->next = cache.head[sizeClass];
+        cache.head[sizeClass] = block;
+        cache.count[sizeClass]++;
+        if (cache.count[sizeClass] > threadCacheLimit) {
+            flushThreadCache(cache, sizeClass, transferBatch);
+        }
+    }
+
+    std::size_t SizeClassAllocator::slabCount() {
+        return _slab_count.load(std::memory_order_relaxed);
+    }
+}  // namespace GLaDOS
@@ -0,0 +1,36 @@
+#ifndef GLADOS_SIZECLASSALLOCATOR_H
+#define GLADOS_SIZECLASSALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GLaDOS {
+    // Segregated free list allocator for small blocks (container nodes, small vectors).
+    // Each size class is carved from 64KB slabs, freed blocks are kept in a per-thread cache and
+    // exchanged in batches with a central list per class. Slabs are never returned to the system.
+    // The caller passes the block size to deallocate, like std::allocator does.
+    class SizeClassAllocator {
+      public:
+        static constexpr std::size_t granularity = 16;
+        static constexpr std::size_t maxSmallSize = 256;
+        static constexpr std::size_t classCount = maxSmallSize / granularity;
+        static constexpr std::size_t slabSize = 64 * 1024;
+        static constexpr uint32_t threadCacheLimit = 128;  // blocks per class kept by a thread
+        static constexpr uint32_t transferBatch = 32;  // blocks moved between thread cache and central list at once
+
+        SizeClassAllocator() = delete;
+
+        static constexpr bool isSmall(std::size_t size, std::size_t align) {
+            return size != 0 && size <= maxSmallSize && align <= granularity;
+        }
+        static constexpr std::size_t sizeClassOf(std::size_t size) {
+            return (size - 1) / granularity;
+        }
+
+        static void* allocate(std::size_t size);
+        static void deallocate(void* ptr, std::size_t size);
+        static std::size_t slabCount();
+    };
+}  // namespace GLaDOS
+
+#endif  //GLADOS_SIZECLASSALLOCATOR_H
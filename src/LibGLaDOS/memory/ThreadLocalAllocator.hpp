@@ -5,10 +5,23 @@
 #include "utils/ThreadLocalStorage.hpp"
 
 namespace GLaDOS {
+    // Object placed in a thread local pool, remembers the pool of the allocating thread.
+    template <typename T>
+    struct OwnedBlock {
+        template <typename... Args>
+        explicit OwnedBlock(void* pool, Args&&... args) : value(std::forward<Args>(args)...), owner{pool} {}
+
+        T value;  // must be the first member, T* and OwnedBlock<T>* are interchanged
+        void* owner;
+    };
+
     // Thread local fixed size memory pool allocator (lock-free).
-    template <typename T, typename Allocator = STLAllocator<AlignedMemBlock<T>>>
+    // Objects may be deallocated on any thread, they are returned to the pool of the allocating thread
+    // which must outlive every object it allocated.
+    template <typename T, typename Allocator = STLAllocator<AlignedMemBlock<OwnedBlock<T>>>>
     class ThreadLocalAllocator {
-        using AllocatorType = ThreadLocalStorage<FixedSizeMemoryPool<T, Allocator>>;
+        using PoolType = FixedSizeMemoryPool<OwnedBlock<T>, Allocator>;
+        using AllocatorType = ThreadLocalStorage<PoolType>;
 
       public:
         ThreadLocalAllocator() = default;
@@ -24,12 +37,20 @@ namespace GLaDOS {
     template <typename T, typename Allocator>
     template <typename... Args>
     T* ThreadLocalAllocator<T, Allocator>::allocate(Args&&... args) {
-        return AllocatorType::get().allocate(std::forward<Args>(args)...);
+        PoolType& pool = AllocatorType::get();
+        OwnedBlock<T>* block = pool.allocate(static_cast<void*>(&pool), std::forward<Args>(args)...);
+        return block != nullptr ? std::addressof(block->value) : nullptr;
     }
 
     template <typename T, typename Allocator>
     void ThreadLocalAllocator<T, Allocator>::deallocate(T* ptr) {
-        AllocatorType::get().deallocate(ptr);
+        OwnedBlock<T>* block = reinterpret_cast<OwnedBlock<T>*>(ptr);
+        PoolType* owner = static_cast<PoolType*>(block->owner);
+        if (owner == &AllocatorType::get()) {
+            owner->deallocate(block);
+        } else {
+            owner->deallocateRemote(block);
+        }
     }
 }  // namespace GLaDOS
 
@@ -0,0 +1,68 @@
+#include "HeadlessRunner.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "Platform.h"
+#include "Timer.h"
+#include "core/SceneManager.h"
+#include "utils/LoggerRegistry.h"
+
+namespace GLaDOS {
+    Logger* HeadlessRunner::logger = LoggerRegistry::getInstance().makeAndGetLogger("HeadlessRunner");
+
+    FrameStatistics HeadlessRunner::run(const HeadlessParams& params) {
+        if (!Platform::isHeadless()) {
+            LOG_WARN(logger, "Platform is not headless, renderer calls go to the platform renderer.");
+        }
+
+        Timer& timer = Timer::getInstance();
+        SceneManager& sceneManager = SceneManager::getInstance();
+        FrameStatistics statistics;
+        Vector<real> frameTimes;
+        frameTimes.reserve(params.frameCount);
+
+        HighResolutionTimePoint lastFrameStart = Timer::now();
+        for (uint32_t frame = 0; frame < params.frameCount && Platform::getInstance().isRunning(); frame++) {
+            HighResolutionTimePoint frameStart = Timer::now();
+            real deltaTime = params.frameTime > 0 ? params.frameTime : (frame == 0 ? 0 : Timer::getInterval(lastFrameStart, frameStart));
+            lastFrameStart = frameStart;
+
+            timer.update(deltaTime);
+            statistics.fixedStepCount += static_cast<uint32_t>(timer.fixedStepsThisFrame());
+            sceneManager.update(timer.deltaTime());
+            sceneManager.render();
+
+            real frameTime = Timer::getInterval(frameStart, Timer::now());
+            frameTimes.push_back(frameTime);
+            if (params.paced && params.frameTime > frameTime) {
+                std::this_thread::sleep_for(std::chrono::duration<real>(params.frameTime - frameTime));
+            }
+        }
+
+        statistics.frameCount = static_cast<uint32_t>(frameTimes.size());
+        if (!frameTimes.empty()) {
+            for (real frameTime : frameTimes) {
+                statistics.totalTime += frameTime;
+            }
+            std::sort(frameTimes.begin(), frameTimes.end());
+            statistics.minFrameTime = frameTimes.front();
+            statistics.maxFrameTime = frameTimes.back();
+            statistics.meanFrameTime = statistics.totalTime / static_cast<real>(frameTimes.size());
+            statistics.medianFrameTime = frameTimes[frameTimes.size() / 2];
+            statistics.p99FrameTime = frameTimes[std::min(frameTimes.size() - 1, frameTimes.size() * 99 / 100)];
+        }
+
+        if (params.printStatistics) {
+            printStatistics(statistics);
+        }
+        return statistics;
+    }
+
+    void HeadlessRunner::printStatistics(const FrameStatistics& statistics) {
+        LOG_INFO(logger, "{0} frames, {1} fixed steps in {2} ms", statistics.frameCount, statistics.fixedStepCount, statistics.totalTime * 1000);
+        LOG_INFO(logger, "frame time ms: min {0} / mean {1} / median {2} / p99 {3} / max {4}",
+                 statistics.minFrameTime * 1000, statistics.meanFrameTime * 1000, statistics.medianFrameTime * 1000,
+                 statistics.p99FrameTime * 1000, statistics.maxFrameTime * 1000);
+    }
+}  // namespace GLaDOS
@@ -0,0 +1,40 @@
+#ifndef GLADOS_HEADLESSRUNNER_H
+#define GLADOS_HEADLESSRUNNER_H
+
+#include "utils/Enumeration.h"
+
+namespace GLaDOS {
+    struct HeadlessParams {
+        uint32_t frameCount{0};
+        real frameTime{0};  // seconds every frame advances the timer, 0 runs unlocked on the measured frame time
+        bool paced{false};  // sleeps out the rest of frameTime so a fixed rate run keeps wall clock time
+        bool printStatistics{true};
+    };
+
+    // wall clock time spent in frames, sleeping excluded
+    struct FrameStatistics {
+        uint32_t frameCount{0};
+        uint32_t fixedStepCount{0};
+        real totalTime{0};
+        real minFrameTime{0};
+        real maxFrameTime{0};
+        real meanFrameTime{0};
+        real medianFrameTime{0};
+        real p99FrameTime{0};
+    };
+
+    class Logger;
+    // Drives the active scene of the SceneManager the way the platform loop does, without window, input or GPU.
+    // Call Platform::initializeHeadless before creating scenes so renderer resources come from the NullRenderer.
+    class HeadlessRunner {
+      public:
+        // runs params.frameCount frames or until Platform::quit is called
+        static FrameStatistics run(const HeadlessParams& params);
+        static void printStatistics(const FrameStatistics& statistics);
+
+      private:
+        static Logger* logger;
+    };
+}  // namespace GLaDOS
+
+#endif  //GLADOS_HEADLESSRUNNER_H
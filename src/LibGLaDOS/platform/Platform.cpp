@@ -4,7 +4,9 @@
 
 #include "OSTypes.h"
 #include "platform/render/FrameBuffer.h"
+#include "platform/render/null/NullRenderer.h"
 #include "utils/LoggerRegistry.h"
+#include "utils/Utility.h"
 
 #ifdef PLATFORM_WINDOW
 #include <process.h>
@@ -17,8 +19,43 @@
 
 namespace GLaDOS {
     Logger* Platform::logger = LoggerRegistry::getInstance().makeAndGetLogger("Platform");
+    bool Platform::headless = false;
+
+    bool Platform::initializeHeadless(int width, int height) {
+        printLogo();
+        LOG_TRACE(logger, "Initialize headless Platform...");
+
+        if (width <= 0 || height <= 0) {
+            LOG_ERROR(logger, "width and height should not be less than 0.");
+            return false;
+        }
+
+        if (!NullRenderer::getInstance().initialize(width, height)) {
+            LOG_ERROR(logger, "NullRenderer initialize failed.");
+            return false;
+        }
+
+        headless = true;
+        mContentWidth = width;
+        mContentHeight = height;
+        mContentScale = 1;
+        mIsFocused = true;
+        mIsOccluded = false;
+        mIsRunning = true;
+        for (bool& key : mKeys) {
+            key = false;
+        }
+        for (bool& mouseButton : mMouseButtons) {
+            mouseButton = false;
+        }
+
+        return true;
+    }
+
     void Platform::quit() {
-        mMainFrameBuffer->release();
+        if (mMainFrameBuffer != nullptr) {
+            mMainFrameBuffer->release();
+        }
         mIsRunning = false;
     }
 
@@ -26,6 +63,10 @@ namespace GLaDOS {
 
     int Platform::getContentHeight() const { return mContentHeight; }
 
+    real Platform::getDrawableWidth() const { return static_cast<real>(mContentWidth) * mContentScale; }
+
+    real Platform::getDrawableHeight() const { return static_cast<real>(mContentHeight) * mContentScale; }
+
     std::string Platform::titleName() const { return mTitleName; }
 
     bool Platform::isFullScreen() const { return mIsFullScreen; }
@@ -38,11 +79,56 @@ namespace GLaDOS {
 
     bool Platform::isShowCursor() const { return mIsShowCursor; }
 
-    Color Platform::clearColor() const { return mMainFrameBuffer->getClearColor(); }
+    Color Platform::clearColor() const {
+        if (mMainFrameBuffer == nullptr) {  // headless
+            return Color{};
+        }
+        return mMainFrameBuffer->getClearColor();
+    }
 
     real Platform::contentScale() const { return mContentScale; }
 
-    void Platform::setClearColor(const Color& clearColor) { mMainFrameBuffer->setClearColor(clearColor); }
+    void Platform::setClearColor(const Color& clearColor) {
+        if (mMainFrameBuffer != nullptr) {
+            mMainFrameBuffer->setClearColor(clearColor);
+        }
+    }
+
+    Renderer& Platform::getRenderer() {
+        if (headless) {
+            return NullRenderer::getInstance();
+        }
+        return platformRenderer();
+    }
+
+    bool Platform::isHeadless() { return headless; }
+
+#if HEADLESS_BUILD == 1
+    //////////////////////////////////////////////////////////////
+    //// Platform definition without a window backend
+    //////////////////////////////////////////////////////////////
+
+    Platform::Platform() {
+        setDestructionPhase(4);
+    }
+
+    Platform::~Platform() = default;
+
+    bool Platform::initialize([[maybe_unused]] const PlatformParams& params) {
+        LOG_ERROR(logger, "Built without a window backend, use Platform::initializeHeadless instead.");
+        return false;
+    }
+
+    void Platform::render() {
+    }
+
+    void Platform::update() {
+    }
+
+    Renderer& Platform::platformRenderer() {
+        return NullRenderer::getInstance();
+    }
+#endif
 
     std::size_t Platform::getThreadId() noexcept {
 #if defined(PLATFORM_MACOS)
@@ -35,6 +35,8 @@ namespace GLaDOS {
 
         // Platform specific methods
         bool initialize(const PlatformParams& params);
+        // Runs without a window or input, getRenderer returns the NullRenderer from then on. see HeadlessRunner
+        bool initializeHeadless(int width, int height);
         void render();
         void update();
         void setContentRect(int width, int height);
@@ -59,6 +61,7 @@ namespace GLaDOS {
         void setClearColor(const Color& clearColor);
 
         static Renderer& getRenderer();
+        static bool isHeadless();
         static std::size_t getThreadId() noexcept;
         static int getPid() noexcept;
         static std::size_t getConcurrency() noexcept;
@@ -72,8 +75,10 @@ namespace GLaDOS {
         void setKeyDown(KeyCode keycode);
         void setKeyUp(KeyCode keycode);
         void printLogo() const;
+        static Renderer& platformRenderer();  // renderer of the platform backend
 
         static Logger* logger;
+        static bool headless;
 
         int mContentWidth, mContentHeight;
         std::string mTitleName;
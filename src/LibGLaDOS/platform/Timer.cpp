@@ -1,4 +1,8 @@
 #include "Timer.h"
+
+#include <algorithm>
+#include <cmath>
+
 #include "core/SceneManager.h"
 
 namespace GLaDOS {
@@ -9,14 +13,15 @@ namespace GLaDOS {
 
     void Timer::update() {
         mCurrentTime = now();
-        mUnscaledDeltaTime = getInterval(mStart, mCurrentTime);
+        real interval = getInterval(mStart, mCurrentTime);
         mStart = mCurrentTime;
+        update(interval);
+    }
 
+    void Timer::update(real unscaledDeltaTime) {
+        mUnscaledDeltaTime = unscaledDeltaTime;
         mFixedStepAccumulator += mUnscaledDeltaTime;
-        if (mFixedStepAccumulator >= mFixedDeltaTime) {
-            SceneManager::getInstance().fixedUpdate(mFixedDeltaTime);
-            mFixedStepAccumulator -= mFixedDeltaTime;
-        }
+        runFixedSteps();
 
         mDeltaTime = mUnscaledDeltaTime * mTimeScale;
         mElapsedTime += mDeltaTime;
@@ -31,9 +36,28 @@ namespace GLaDOS {
         }
     }
 
+    void Timer::runFixedSteps() {
+        mFixedStepsThisFrame = 0;
+        while (mFixedStepAccumulator >= mFixedDeltaTime && mFixedStepsThisFrame < mMaxFixedStepsPerFrame) {
+            real subStepTime = mFixedDeltaTime / static_cast<real>(mFixedSubSteps);
+            for (int i = 0; i < mFixedSubSteps; i++) {
+                SceneManager::getInstance().fixedUpdate(subStepTime);
+            }
+            mFixedStepAccumulator -= mFixedDeltaTime;
+            mFixedStepsThisFrame++;
+        }
+
+        if (mFixedStepAccumulator >= mFixedDeltaTime) {  // capped, keep only the part of a step
+            real remainder = std::fmod(mFixedStepAccumulator, mFixedDeltaTime);
+            mDroppedFixedTime += mFixedStepAccumulator - remainder;
+            mFixedStepAccumulator = remainder;
+        }
+    }
+
     void Timer::reset() {
         mStart = now();
         mTimeScale = 1.0;
+        mFixedStepAccumulator = 0.0;
     }
 
     real Timer::deltaTime() const { return mDeltaTime; }
@@ -46,6 +70,26 @@ namespace GLaDOS {
 
     real Timer::fixedDeltaTime() const { return mFixedDeltaTime; }
 
+    void Timer::setFixedDeltaTime(real seconds) {
+        if (seconds > 0) {
+            mFixedDeltaTime = seconds;
+        }
+    }
+
+    void Timer::setMaxFixedStepsPerFrame(int steps) { mMaxFixedStepsPerFrame = std::max(steps, 1); }
+
+    int Timer::maxFixedStepsPerFrame() const { return mMaxFixedStepsPerFrame; }
+
+    void Timer::setFixedSubSteps(int count) { mFixedSubSteps = std::max(count, 1); }
+
+    int Timer::fixedSubSteps() const { return mFixedSubSteps; }
+
+    int Timer::fixedStepsThisFrame() const { return mFixedStepsThisFrame; }
+
+    real Timer::droppedFixedTime() const { return mDroppedFixedTime; }
+
+    real Timer::fixedStepAlpha() const { return std::clamp(mFixedStepAccumulator / mFixedDeltaTime, real(0), real(1)); }
+
     int Timer::fps() const { return mFrameRate; }
 
     void Timer::setTimeScale(real value) { mTimeScale = value; }
@@ -14,6 +14,8 @@ namespace GLaDOS {
         Timer();
 
         void update();
+        // advances the clock by `unscaledDeltaTime` seconds instead of reading it, for headless and test runs
+        void update(real unscaledDeltaTime);
 
         void reset();
         real deltaTime() const;
@@ -21,6 +23,18 @@ namespace GLaDOS {
         real elapsedTime() const;
         real elapsedTimeUnscaled() const;
         real fixedDeltaTime() const;
+        void setFixedDeltaTime(real seconds);
+        // Fixed steps run per frame at most. Time beyond the cap is dropped so a slow frame can not make the
+        // next one slower still, the simulation then runs behind the wall clock.
+        void setMaxFixedStepsPerFrame(int steps);
+        int maxFixedStepsPerFrame() const;
+        // each fixed step calls fixedUpdate `count` times with fixedDeltaTime / count
+        void setFixedSubSteps(int count);
+        int fixedSubSteps() const;
+        int fixedStepsThisFrame() const;
+        real droppedFixedTime() const;  // seconds dropped by the step cap so far
+        // 0 to 1, how far the frame is past the last fixed step, renderers blend the previous and current fixed state with it
+        real fixedStepAlpha() const;
 
         int fps() const;
         void setTimeScale(real value);
@@ -28,6 +42,8 @@ namespace GLaDOS {
         static real getInterval(HighResolutionTimePoint start, HighResolutionTimePoint end);
 
       private:
+        void runFixedSteps();
+
         HighResolutionTimePoint mStart;
         HighResolutionTimePoint mCurrentTime;
         real mFrameAccumulator{0.0};  // for internal use
@@ -41,6 +57,10 @@ namespace GLaDOS {
         real mElapsedTime{0.0};
         real mUnscaledElapsedTime{0.0};
         real mFixedDeltaTime{0.02};
+        int mMaxFixedStepsPerFrame{8};
+        int mFixedSubSteps{1};
+        int mFixedStepsThisFrame{0};
+        real mDroppedFixedTime{0.0};
     };
 }  // namespace GLaDOS
 
@@ -630,15 +630,7 @@ namespace GLaDOS {
         mIsFullScreen = isFullScreen;
     }
 
-    real Platform::getDrawableWidth() const {
-        return static_cast<real>(mContentWidth) * mContentScale;
-    }
-
-    real Platform::getDrawableHeight() const {
-        return static_cast<real>(mContentHeight) * mContentScale;
-    }
-
-    Renderer& Platform::getRenderer() {
+    Renderer& Platform::platformRenderer() {
         return MetalRenderer::getInstance();
     }
 }
@@ -1,6 +1,6 @@
 #include "XWindowPlatform.h"
 
-#ifdef PLATFORM_LINUX
+#if defined(PLATFORM_LINUX) && HEADLESS_BUILD == 0
 
 #include <algorithm>
 #include <set>
@@ -9,6 +9,8 @@
 #include "core/SceneManager.h"
 #include "platform/Input.h"
 #include "platform/Timer.h"
+#include "platform/render/null/NullRenderer.h"
+#include "platform/render/vulkan/VulkanRenderer.h"
 
 namespace GLaDOS {
     Logger* XWindowPlatform::logger = LoggerRegistry::getInstance().makeAndGetLogger("XWindowPlatform");
@@ -28,10 +30,15 @@ namespace GLaDOS {
             return false;
         }
 
+#if VULKAN_RENDERER == 1
         if (!VulkanRenderer::getInstance().initialize(params.width, params.height)) {
             LOG_ERROR(logger, "VulkanRenderer initialize failed.");
             return false;
         }
+#else
+        LOG_ERROR(logger, "Built without the Vulkan renderer, use Platform::initializeHeadless instead.");
+        return false;
+#endif
 
         Platform::getInstance().registerKeyMap();
 
@@ -118,6 +125,14 @@ namespace GLaDOS {
     void Platform::update() {
         XWindowPlatform::xWindowPlatformInstance->dispatchEvent();
     }
+
+    Renderer& Platform::platformRenderer() {
+#if VULKAN_RENDERER == 1
+        return VulkanRenderer::getInstance();
+#else
+        return NullRenderer::getInstance();
+#endif
+    }
 }
 
 #endif
\ No newline at end of file
@@ -1,17 +1,24 @@
 #ifndef GLADOS_XWINDOWPLATFORM_H
 #define GLADOS_XWINDOWPLATFORM_H
 
+#include "Config.h"
 #include "platform/OSTypes.h"
 
-#ifdef PLATFORM_LINUX
+#if defined(PLATFORM_LINUX) && HEADLESS_BUILD == 0
 
-#include <X11/X.h>
-#include <X11/Xlib.h>
-#include <X11/Xutil.h>
 #include <string>
 #include <vector>
 #include "platform/Platform.h"
 
+#include <X11/X.h>
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+// X11 defines these as macros, which clash with enumerators of utils/Enumeration.h in every header included later
+#undef None
+#undef Always
+#undef False
+#undef Bool
+
 namespace GLaDOS {
     class Logger;
     class Platform;
@@ -15,8 +15,8 @@ namespace GLaDOS {
         DELETE_T(mShaderProgram, ShaderProgram);
     }
 
-    Material::Material(const Material& other) : mTextures{other.mTextures} {
-        RenderPipelineState* renderPipelineState = Platform::getRenderer().createRenderPipelineState(mShaderProgram->renderPipelineState()->mRenderPipelineDescription);
+    Material::Material(const Material& other) : RefCounted(), mTextures{other.mTextures} {
+        RenderPipelineState* renderPipelineState = Platform::getRenderer().createRenderPipelineState(other.mShaderProgram->renderPipelineState()->mRenderPipelineDescription);
         mShaderProgram = Platform::getRenderer().createShaderProgram(other.mShaderProgram->getVertexShader(), other.mShaderProgram->getFragmentShader(), renderPipelineState);
         RasterizerDescription rasterizerDescription = other.mShaderProgram->rasterizerState()->mRasterizerDescription;
         DepthStencilDescription depthStencilDescription = other.mShaderProgram->depthStencilState()->mDepthStencilDescription;
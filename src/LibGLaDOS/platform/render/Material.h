@@ -4,11 +4,13 @@
 #include "utils/Utility.h"
 #include "math/Color.h"
 #include "utils/Enumeration.h"
+#include "utils/RefCounted.h"
 
 namespace GLaDOS {
     class Texture;
     class ShaderProgram;
-    class Material {
+    // Shared by renderables through RefPtr, clones of a renderer reference the same material.
+    class Material : public RefCounted {
       public:
         Material() = default;
         explicit Material(ShaderProgram* shaderProgram);
@@ -10,7 +10,5 @@ namespace GLaDOS {
         LOG_TRACE(logger, "Renderable instance created: {0}", mInstanceId);
     }
 
-    Renderable::~Renderable() {
-        DELETE_T(mMaterial, Material);
-    }
+    Renderable::~Renderable() = default;
 }  // namespace GLaDOS
\ No newline at end of file
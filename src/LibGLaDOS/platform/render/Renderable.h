@@ -1,6 +1,7 @@
 #ifndef GLADOS_RENDERABLE_H
 #define GLADOS_RENDERABLE_H
 
+#include "utils/RefPtr.hpp"
 #include "utils/UniqueId.h"
 
 namespace GLaDOS {
@@ -10,6 +11,7 @@ namespace GLaDOS {
     class Renderable : public UniqueId {
         friend class Renderer;
         friend class MetalRenderer;
+        friend class NullRenderer;
 
       public:
         Renderable();
@@ -19,11 +21,11 @@ namespace GLaDOS {
         virtual void bindParams() = 0;  // called very frame in rendering loop
 
         Mesh* getMesh() const { return mMesh; }
-        Material* getMaterial() const { return mMaterial; }
+        Material* getMaterial() const { return mMaterial.get(); }
 
       protected:
-        Mesh* mMesh{nullptr};
-        Material* mMaterial{nullptr};
+        Mesh* mMesh{nullptr};  // owned by ResourceManager
+        RefPtr<Material> mMaterial;  // released with the last renderable which uses it
 
       private:
         static Logger* logger;
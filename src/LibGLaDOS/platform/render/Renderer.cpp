@@ -3,7 +3,9 @@
 #include "platform/render/VertexBuffer.h"
 #include "platform/render/IndexBuffer.h"
 #include "core/GameObject.hpp"
+#if HEADLESS_BUILD == 0
 #include "core/loader/AssimpLoader.h"
+#endif
 #include "resource/ResourceManager.h"
 
 namespace GLaDOS {
@@ -15,6 +17,8 @@ namespace GLaDOS {
             return static_cast<Mesh*>(resource);
         }
 
+        // buffers the mesh creates while building are accounted to the mesh as well
+        ScopedMemoryTag memoryTag{MemoryTag::Mesh};
         Mesh* mesh = NEW_T(Mesh(name, primitiveTopology, GPUBufferUsage::Private, GPUBufferUsage::Private));
         if (!mesh->build(vertexBuffer, indexBuffer)) {
             DELETE_T(mesh, Mesh);
@@ -32,6 +36,7 @@ namespace GLaDOS {
             return static_cast<Mesh*>(resource);
         }
 
+        ScopedMemoryTag memoryTag{MemoryTag::Mesh};
         Mesh* mesh = NEW_T(Mesh(name, primitiveTopology, vertexUsage, indexUsage));
         if (!mesh->build(vertexBuffer, indexBuffer)) {
             DELETE_T(mesh, Mesh);
@@ -49,6 +54,7 @@ namespace GLaDOS {
             return static_cast<Mesh*>(resource);
         }
 
+        ScopedMemoryTag memoryTag{MemoryTag::Mesh};
         Mesh* mesh = NEW_T(Mesh(name));
         if (!mesh->build(vertexBuffer, indexBuffer)) {
             DELETE_T(mesh, Mesh);
@@ -61,14 +67,22 @@ namespace GLaDOS {
     }
 
     bool Renderer::createPrefabFromFile(const std::string& meshPath, GameObject* parent) {
+#if HEADLESS_BUILD == 0
         return AssimpLoader::getInstance().loadFromFile(meshPath, parent);
+#else
+        LOG_ERROR(logger, "Built without assimp, failed to load `{0}`", meshPath);
+        return false;
+#endif
     }
 
     VertexBuffer* Renderer::createVertexBuffer(const VertexFormatDescriptor& vertexFormatDescriptor, std::size_t count) {
+        // the payload is resized in the constructor, so it is tagged together with the object
+        ScopedMemoryTag memoryTag{MemoryTag::Mesh};
         return NEW_T(VertexBuffer(vertexFormatDescriptor, count));
     }
 
     IndexBuffer* Renderer::createIndexBuffer(std::size_t stride, std::size_t count) {
+        ScopedMemoryTag memoryTag{MemoryTag::Mesh};
         return NEW_T(IndexBuffer(stride, count));
     }
 }
\ No newline at end of file
@@ -22,7 +22,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, int value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -32,7 +32,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, unsigned int value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -42,7 +42,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, float value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -52,7 +52,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Vec2& value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -62,7 +62,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Point<real>& value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -72,7 +72,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Vec3& value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -82,7 +82,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Vec4& value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -92,7 +92,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Color& value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -102,7 +102,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Point<int32_t>& value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -112,7 +112,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Size<int32_t>& value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -122,7 +122,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Rect<int32_t>& value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -132,7 +132,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Point<uint32_t>& value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -142,7 +142,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Size<uint32_t>& value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -152,7 +152,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Rect<uint32_t>& value) {
         auto it = mUniforms.find(name);
         if (it == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -162,7 +162,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, float* values, std::size_t count) {
         auto iter = mUniforms.find(name);
         if (iter == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -172,7 +172,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, Vec2* values, std::size_t count) {
         auto iter = mUniforms.find(name);
         if (iter == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -182,7 +182,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, Vec3* values, std::size_t count) {
         auto iter = mUniforms.find(name);
         if (iter == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -192,7 +192,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, Vec4* values, std::size_t count) {
         auto iter = mUniforms.find(name);
         if (iter == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -202,7 +202,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, Color* values, std::size_t count) {
         auto iter = mUniforms.find(name);
         if (iter == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -212,7 +212,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, Mat4<real>* values, std::size_t count) {
         auto iter = mUniforms.find(name);
         if (iter == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -222,7 +222,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, const Mat4<real>& value) {
         auto iter = mUniforms.find(name);
         if (iter == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -232,7 +232,7 @@ namespace GLaDOS {
     void ShaderProgram::setUniform(const std::string& name, bool value) {
         auto iter = mUniforms.find(name);
         if (iter == mUniforms.end()) {
-            LOG_WARN(logger, "uniform `{0}` not exist", name);
+            warnMissingUniform(name);
             return;
         }
 
@@ -270,6 +270,12 @@ namespace GLaDOS {
         return mUniforms.size();
     }
 
+    void ShaderProgram::warnMissingUniform(const std::string& name) const {
+        if (!mAcceptsAnyUniform) {
+            LOG_WARN(logger, "uniform `{0}` not exist", name);
+        }
+    }
+
     bool ShaderProgram::isValid() const {
         return mIsValid;
     }
@@ -78,6 +78,7 @@ namespace GLaDOS {
 
       protected:
         void reserveUniformMemory();
+        void warnMissingUniform(const std::string& name) const;
 
         static Logger* logger;
         UnorderedMap<std::string, Uniform*> mUniforms;
@@ -85,6 +86,7 @@ namespace GLaDOS {
         RasterizerState* mRasterizerState{nullptr};
         RenderPipelineState* mRenderPipelineState{nullptr};
         bool mIsValid{false};
+        bool mAcceptsAnyUniform{false};  // programs without reflected uniforms, e.g. of the NullRenderer
         Blob mVertexUniformBuffer;
         Blob mFragmentUniformBuffer;
         Shader* mVertexShader{nullptr};
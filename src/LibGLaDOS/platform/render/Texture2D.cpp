@@ -98,7 +98,7 @@ namespace GLaDOS {
         for (uint32_t level = 1; level < mMipmapCount; level++) {
             mipWidth = (mipWidth >> 1);
             mipHeight = (mipHeight >> 1);
-            uint8_t* mipData = static_cast<uint8_t*>(MALLOC(mipWidth * mipHeight * mChannels));
+            uint8_t* mipData = static_cast<uint8_t*>(MALLOC_TAGGED(mipWidth * mipHeight * mChannels, MemoryTag::Texture));
             if (stbir_resize_uint8(data, mWidth, mHeight, 0, mipData, mipWidth, mipHeight, 0, mChannels) == 0) {
                 LOG_ERROR(logger, "Failed to create mipmap [name={0}, width={1}, height={2}, level={3}, bpp={4}]", mName, mipWidth, mipHeight, level, mChannels);
                 return false;
@@ -11,6 +11,7 @@
 #include "MetalTextureCube.h"
 #include "MetalRenderTexture.h"
 #include "MetalTypes.h"
+#include "platform/render/Material.h"
 #include "platform/render/Mesh.h"
 #include "platform/render/VertexBuffer.h"
 #include "resource/ResourceManager.h"
@@ -0,0 +1,98 @@
+#include "NullRenderObjects.h"
+
+namespace GLaDOS {
+    NullGPUBuffer::NullGPUBuffer(GPUBufferType type, GPUBufferUsage usage) : GPUBuffer{type, usage} {
+    }
+
+    bool NullGPUBuffer::uploadData([[maybe_unused]] void* data, std::size_t size) {
+        mSize = size;
+        return true;
+    }
+
+    NullShaderProgram::NullShaderProgram(RenderPipelineState* renderPipelineState) : ShaderProgram{renderPipelineState} {
+        mAcceptsAnyUniform = true;
+    }
+
+    bool NullShaderProgram::createShaderProgram(Shader* vertex, Shader* fragment) {
+        mVertexShader = vertex;
+        mFragmentShader = fragment;
+        mIsValid = true;
+        return true;
+    }
+
+    void NullRenderable::build() {
+    }
+
+    void NullRenderable::bindParams() {
+    }
+
+    void NullFrameBuffer::begin() {
+    }
+
+    void NullFrameBuffer::end() {
+    }
+
+    void NullFrameBuffer::makeDepthStencilTexture() {
+    }
+
+    NullTexture2D::NullTexture2D(const std::string& name, PixelFormat format) : Texture2D{name, format} {
+    }
+
+    bool NullTexture2D::loadTextureFromFile() {
+        return true;
+    }
+
+    bool NullTexture2D::loadTextureFromBuffer([[maybe_unused]] Blob& buffer) {
+        return true;
+    }
+
+    bool NullTexture2D::generateTexture(uint32_t x, uint32_t y, [[maybe_unused]] uint8_t* data) {
+        mWidth = x;
+        mHeight = y;
+        return true;
+    }
+
+    void NullTexture2D::replaceRegion([[maybe_unused]] uint32_t x, [[maybe_unused]] uint32_t y, [[maybe_unused]] uint32_t w, [[maybe_unused]] uint32_t h, [[maybe_unused]] uint32_t level, [[maybe_unused]] uint8_t* data) {
+    }
+
+    Blob NullTexture2D::encodeToPNG() const {
+        return Blob{};
+    }
+
+    Blob NullTexture2D::encodeToJPG() const {
+        return Blob{};
+    }
+
+    Blob NullTexture2D::encodeToBMP() const {
+        return Blob{};
+    }
+
+    Blob NullTexture2D::encodeToTGA() const {
+        return Blob{};
+    }
+
+    NullTextureCube::NullTextureCube(const std::string& name, PixelFormat format) : TextureCube{name, format} {
+    }
+
+    bool NullTextureCube::loadTextureFromFile([[maybe_unused]] const Array<std::string, 6>& names) {
+        return true;
+    }
+
+    bool NullTextureCube::loadTextureFromBuffer([[maybe_unused]] const Vector<std::reference_wrapper<Blob>>& buffer) {
+        return true;
+    }
+
+    bool NullTextureCube::generateTexture([[maybe_unused]] Vector<uint8_t*> data) {
+        return true;
+    }
+
+    void NullTextureCube::replaceRegion([[maybe_unused]] uint32_t size, [[maybe_unused]] uint32_t slice, [[maybe_unused]] uint32_t bytesPerRow, [[maybe_unused]] uint32_t bytesPerImage, [[maybe_unused]] uint8_t* data) {
+    }
+
+    NullRenderTexture::NullRenderTexture(PixelFormat format) : RenderTexture{format} {
+    }
+
+    bool NullRenderTexture::generateTexture() {
+        return true;
+    }
+}  // namespace GLaDOS
@@ -0,0 +1,86 @@
+#ifndef GLADOS_NULLRENDEROBJECTS_H
+#define GLADOS_NULLRENDEROBJECTS_H
+
+#include "platform/render/FrameBuffer.h"
+#include "platform/render/GPUBuffer.h"
+#include "platform/render/Renderable.h"
+#include "platform/render/RenderTexture.h"
+#include "platform/render/ShaderProgram.h"
+#include "platform/render/Texture2D.h"
+#include "platform/render/TextureCube.h"
+
+namespace GLaDOS {
+    // Inert objects handed out by the NullRenderer. They accept every upload and keep nothing on a GPU,
+    // so meshes, materials and renderers are built the same way as with a real backend.
+    class NullGPUBuffer : public GPUBuffer {
+      public:
+        NullGPUBuffer(GPUBufferType type, GPUBufferUsage usage);
+        ~NullGPUBuffer() override = default;
+
+        bool uploadData(void* data, std::size_t size) override;
+    };
+
+    class NullShaderProgram : public ShaderProgram {
+      public:
+        NullShaderProgram(RenderPipelineState* renderPipelineState);
+        ~NullShaderProgram() override = default;
+
+        bool createShaderProgram(Shader* vertex, Shader* fragment) override;
+    };
+
+    class NullRenderable : public Renderable {
+      public:
+        NullRenderable() = default;
+        ~NullRenderable() override = default;
+
+        void build() override;
+        void bindParams() override;
+    };
+
+    class NullFrameBuffer : public FrameBuffer {
+      public:
+        NullFrameBuffer() = default;
+        ~NullFrameBuffer() override = default;
+
+        void begin() override;
+        void end() override;
+        void makeDepthStencilTexture() override;
+    };
+
+    class NullTexture2D : public Texture2D {
+      public:
+        NullTexture2D(const std::string& name, PixelFormat format);
+        ~NullTexture2D() override = default;
+
+        // nothing is decoded, the texture keeps a zero size
+        bool loadTextureFromFile() override;
+        bool loadTextureFromBuffer(Blob& buffer) override;
+        bool generateTexture(uint32_t x, uint32_t y, uint8_t* data) override;
+        void replaceRegion(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint32_t level, uint8_t* data) override;
+        Blob encodeToPNG() const override;
+        Blob encodeToJPG() const override;
+        Blob encodeToBMP() const override;
+        Blob encodeToTGA() const override;
+    };
+
+    class NullTextureCube : public TextureCube {
+      public:
+        NullTextureCube(const std::string& name, PixelFormat format);
+        ~NullTextureCube() override = default;
+
+        bool loadTextureFromFile(const Array<std::string, 6>& names) override;
+        bool loadTextureFromBuffer(const Vector<std::reference_wrapper<Blob>>& buffer) override;
+        bool generateTexture(Vector<uint8_t*> data) override;
+        void replaceRegion(uint32_t size, uint32_t slice, uint32_t bytesPerRow, uint32_t bytesPerImage, uint8_t* data) override;
+    };
+
+    class NullRenderTexture : public RenderTexture {
+      public:
+        NullRenderTexture(PixelFormat format);
+        ~NullRenderTexture() override = default;
+
+        bool generateTexture() override;
+    };
+}  // namespace GLaDOS
+
+#endif  //GLADOS_NULLRENDEROBJECTS_H
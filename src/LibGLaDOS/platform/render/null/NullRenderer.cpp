@@ -0,0 +1,135 @@
+#include "NullRenderer.h"
+
+#include "NullRenderObjects.h"
+#include "platform/render/Material.h"
+#include "platform/render/RenderState.h"
+#include "platform/render/Texture3D.h"
+#include "resource/ResourceManager.h"
+
+namespace GLaDOS {
+    NullRenderer::NullRenderer() {
+        setDestructionPhase(2);
+    }
+
+    bool NullRenderer::initialize([[maybe_unused]] int width, [[maybe_unused]] int height) {
+        mRenderCount = 0;
+        return true;
+    }
+
+    void NullRenderer::render([[maybe_unused]] Renderable* _renderable, [[maybe_unused]] const Rect<real>& normalizedViewportRect) {
+        mRenderCount++;
+    }
+
+    GPUBuffer* NullRenderer::createGPUVertexBuffer(GPUBufferUsage usage, void* data, std::size_t size) {
+        GPUBuffer* vertexBuffer = NEW_T(NullGPUBuffer(GPUBufferType::VertexBuffer, usage));
+        vertexBuffer->uploadData(data, size);
+        return vertexBuffer;
+    }
+
+    GPUBuffer* NullRenderer::createGPUIndexBuffer(GPUBufferUsage usage, void* data, std::size_t size) {
+        GPUBuffer* indexBuffer = NEW_T(NullGPUBuffer(GPUBufferType::IndexBuffer, usage));
+        indexBuffer->uploadData(data, size);
+        return indexBuffer;
+    }
+
+    ShaderProgram* NullRenderer::createShaderProgram(Shader* vertex, Shader* fragment, RenderPipelineState* renderPipelineState) {
+        if (renderPipelineState == nullptr) {
+            RenderPipelineDescription desc;
+            renderPipelineState = createRenderPipelineState(desc);
+        }
+        NullShaderProgram* shaderProgram = NEW_T(NullShaderProgram(renderPipelineState));
+        shaderProgram->createShaderProgram(vertex, fragment);
+        return shaderProgram;
+    }
+
+    ShaderProgram* NullRenderer::createShaderProgramFromFile([[maybe_unused]] const std::string& vertexName, [[maybe_unused]] const std::string& fragmentName, RenderPipelineState* renderPipelineState) {
+        // shader sources are not read, there is nothing to compile them for
+        return createShaderProgram(nullptr, nullptr, renderPipelineState);
+    }
+
+    ShaderProgram* NullRenderer::createShaderProgramFromFile([[maybe_unused]] const std::string& vertexName, RenderPipelineState* renderPipelineState) {
+        return createShaderProgram(nullptr, nullptr, renderPipelineState);
+    }
+
+    Renderable* NullRenderer::createRenderable(Mesh* mesh, Material* material) {
+        Renderable* renderable = NEW_T(NullRenderable);
+        renderable->mMesh = mesh;
+        renderable->mMaterial = material;
+        renderable->build();
+        return renderable;
+    }
+
+    FrameBuffer* NullRenderer::createFrameBuffer() {
+        return NEW_T(NullFrameBuffer);
+    }
+
+    DepthStencilState* NullRenderer::createDepthStencilState(const DepthStencilDescription& desc) {
+        return NEW_T(DepthStencilState(desc));
+    }
+
+    SamplerState* NullRenderer::createSamplerState(const SamplerDescription& desc) {
+        return NEW_T(SamplerState(desc));
+    }
+
+    RasterizerState* NullRenderer::createRasterizerState(const RasterizerDescription& desc) {
+        return NEW_T(RasterizerState(desc));
+    }
+
+    RenderPipelineState* NullRenderer::createRenderPipelineState(const RenderPipelineDescription& desc) {
+        return NEW_T(RenderPipelineState(desc));
+    }
+
+    RenderTexture* NullRenderer::createRenderTexture(uint32_t width, uint32_t height, PixelFormat format) {
+        NullRenderTexture* renderTexture = NEW_T(NullRenderTexture(format));
+        renderTexture->overrideUsage(TextureUsage::ShaderRead | TextureUsage::RenderTarget);
+        renderTexture->setWidth(width);
+        renderTexture->setHeight(height);
+        renderTexture->generateTexture();
+        return renderTexture;
+    }
+
+    Texture2D* NullRenderer::createTexture2D(const std::string& name, PixelFormat format) {
+        Resource* resource = ResourceManager::getInstance().getResource(name, ResourceType::Texture);
+        if (resource != nullptr) {
+            return static_cast<Texture2D*>(resource);
+        }
+
+        NullTexture2D* texture = NEW_T(NullTexture2D(name, format));
+        ResourceManager::getInstance().store(texture);
+        return texture;
+    }
+
+    Texture2D* NullRenderer::createTexture2D(const std::string& name, PixelFormat format, [[maybe_unused]] Blob& data) {
+        // nothing is uploaded, so the data makes no difference
+        return createTexture2D(name, format);
+    }
+
+    Texture2D* NullRenderer::createTexture2D(const std::string& name, PixelFormat format, [[maybe_unused]] unsigned char* data) {
+        // nothing is uploaded, so the data makes no difference
+        return createTexture2D(name, format);
+    }
+
+    Texture3D* NullRenderer::createTexture3D(const std::string& name) {
+        Resource* resource = ResourceManager::getInstance().getResource(name, ResourceType::Texture);
+        if (resource != nullptr) {
+            return static_cast<Texture3D*>(resource);
+        }
+
+        Texture3D* texture = NEW_T(Texture3D(name, PixelFormat::RGBA32));
+        ResourceManager::getInstance().store(texture);
+        return texture;
+    }
+
+    TextureCube* NullRenderer::createTextureCube(const std::string& name, [[maybe_unused]] const Array<std::string, 6>& cubeNames, PixelFormat format) {
+        Resource* resource = ResourceManager::getInstance().getResource(name, ResourceType::Texture);
+        if (resource != nullptr) {
+            return static_cast<TextureCube*>(resource);
+        }
+
+        NullTextureCube* textureCube = NEW_T(NullTextureCube(name, format));
+        ResourceManager::getInstance().store(textureCube);
+        return textureCube;
+    }
+
+    std::size_t NullRenderer::renderCount() const { return mRenderCount; }
+}  // namespace GLaDOS
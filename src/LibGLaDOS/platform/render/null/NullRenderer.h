@@ -0,0 +1,45 @@
+#ifndef GLADOS_NULLRENDERER_H
+#define GLADOS_NULLRENDERER_H
+
+#include <atomic>
+
+#include "platform/render/Renderer.h"
+#include "utils/Singleton.hpp"
+
+namespace GLaDOS {
+    // Renderer of a headless run. Nothing is drawn, create functions return the inert objects of
+    // NullRenderObjects.h and render calls are only counted.
+    class NullRenderer : public Renderer, public Singleton<NullRenderer> {
+      public:
+        NullRenderer();
+        ~NullRenderer() override = default;
+
+        bool initialize(int width, int height) override;
+        void render(Renderable* _renderable, const Rect<real>& normalizedViewportRect) override;
+
+        GPUBuffer* createGPUVertexBuffer(GPUBufferUsage usage, void* data, std::size_t size) override;
+        GPUBuffer* createGPUIndexBuffer(GPUBufferUsage usage, void* data, std::size_t size) override;
+        ShaderProgram* createShaderProgram(Shader* vertex, Shader* fragment, RenderPipelineState* renderPipelineState) override;
+        ShaderProgram* createShaderProgramFromFile(const std::string& vertexName, const std::string& fragmentName, RenderPipelineState* renderPipelineState) override;
+        ShaderProgram* createShaderProgramFromFile(const std::string& vertexName, RenderPipelineState* renderPipelineState) override;
+        Renderable* createRenderable(Mesh* mesh, Material* material) override;
+        FrameBuffer* createFrameBuffer() override;
+        DepthStencilState* createDepthStencilState(const DepthStencilDescription& desc) override;
+        SamplerState* createSamplerState(const SamplerDescription& desc) override;
+        RasterizerState* createRasterizerState(const RasterizerDescription& desc) override;
+        RenderPipelineState* createRenderPipelineState(const RenderPipelineDescription& desc) override;
+        RenderTexture* createRenderTexture(uint32_t width, uint32_t height, PixelFormat format) override;
+        Texture2D* createTexture2D(const std::string& name, PixelFormat format) override;
+        Texture2D* createTexture2D(const std::string& name, PixelFormat format, Blob& data) override;
+        Texture2D* createTexture2D(const std::string& name, PixelFormat format, unsigned char* data) override;
+        Texture3D* createTexture3D(const std::string& name) override;
+        TextureCube* createTextureCube(const std::string& name, const Array<std::string, 6>& cubeNames, PixelFormat format) override;
+
+        std::size_t renderCount() const;  // render calls since initialize
+
+      private:
+        std::atomic<std::size_t> mRenderCount{0};
+    };
+}  // namespace GLaDOS
+
+#endif  //GLADOS_NULLRENDERER_H
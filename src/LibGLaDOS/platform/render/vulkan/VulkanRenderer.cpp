@@ -1,6 +1,6 @@
 #include "VulkanRenderer.h"
 
-#ifdef PLATFORM_LINUX
+#if defined(PLATFORM_LINUX) && VULKAN_RENDERER == 1
 
 #include "platform/linux/XWindowPlatform"
 
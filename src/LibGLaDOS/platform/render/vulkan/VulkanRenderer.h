@@ -1,9 +1,10 @@
 #ifndef GLADOS_VULKANRENDERER_H
 #define GLADOS_VULKANRENDERER_H
 
+#include "Config.h"
 #include "platform/OSTypes.h"
 
-#ifdef PLATFORM_LINUX
+#if defined(PLATFORM_LINUX) && VULKAN_RENDERER == 1
 
 #define VK_USE_PLATFORM_XLIB_KHR
 #include <vulkan/vulkan.h>
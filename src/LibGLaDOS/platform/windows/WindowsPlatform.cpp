@@ -241,7 +241,7 @@ namespace GLaDOS {
     void Platform::fullScreen(bool isFullScreen) {
     }
 
-    Renderer& Platform::getRenderer() {
+    Renderer& Platform::platformRenderer() {
         return D3DX12Renderer::getInstance();
     }
 }  // namespace GLaDOS
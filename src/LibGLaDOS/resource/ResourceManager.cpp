@@ -17,6 +17,7 @@ namespace GLaDOS {
             return false;
         }
 
+        std::lock_guard<std::mutex> lock{mMutex};
         auto iter = mResources.find(resource->name());
         if(iter != mResources.end()) {
             mResources.erase(iter);
@@ -32,6 +33,7 @@ namespace GLaDOS {
             return false;
         }
 
+        std::lock_guard<std::mutex> lock{mMutex};
         auto result = mResources.insert(std::make_pair(resource->name(), resource));
         if (result.second) {
             LOG_TRACE(logger, "New resource [name: `{0}`, type: `{1}`] registered.", resource->name(), resource->getType().toString());
@@ -42,6 +44,7 @@ namespace GLaDOS {
     }
 
     Resource* ResourceManager::getResource(const std::string& name, ResourceType resourceType) {
+        std::lock_guard<std::mutex> lock{mMutex};
         auto iter = mResources.find(name);
         if (iter != mResources.end() && iter->second->getType() == resourceType) {
             return iter->second;
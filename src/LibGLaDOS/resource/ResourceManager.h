@@ -1,6 +1,8 @@
 #ifndef GLADOS_RESOURCEMANAGER_H
 #define GLADOS_RESOURCEMANAGER_H
 
+#include <mutex>
+
 #include "utils/Singleton.hpp"
 #include "utils/Utility.h"
 #include "Resource.h"
@@ -21,6 +23,7 @@ namespace GLaDOS {
       private:
         static Logger* logger;
         Map<std::string, Resource*> mResources;
+        std::mutex mMutex;  // scenes store resources from the loader thread
     };
 }  // namespace GLaDOS
 
@@ -335,6 +335,21 @@ namespace GLaDOS {
         Error
     };
 
+    enum class UpdatePhase {
+        Gameplay = 0,  // scripts and game logic
+        Animation,
+        RendererPrep,  // after world matrices of the scene are updated
+        TheNumberOfPhase
+    };
+
+    enum class SceneLoadState {
+        Loading = 0,  // onLoad runs on the loader thread
+        Activating,  // onInit and activation steps run on the main thread
+        Done,
+        Failed,
+        TheNumberOfState
+    };
+
     enum class AnimationWrapMode {
         Once = 0,
         Loop,
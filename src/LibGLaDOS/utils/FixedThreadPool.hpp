@@ -26,6 +26,10 @@ namespace GLaDOS {
         std::future<bool> execute(const Function&& task, Args&&... args);
         template <typename Function, typename... Args, typename R = std::invoke_result_t<std::decay_t<Function>, std::decay_t<Args>...>, typename = std::enable_if_t<!std::is_void_v<R>>>
         std::future<R> execute(const Function&& task, Args&&... args);
+        // Splits [0, count) into chunks and calls function(begin, end) once per chunk on the workers.
+        // The calling thread takes chunks as well and returns when every chunk is done.
+        template <typename Function>
+        void parallelFor(std::size_t count, std::size_t chunkSize, Function&& function);
 
         void awaitTermination() const;
         std::size_t getRemainTasksCount() const;
@@ -77,6 +81,41 @@ namespace GLaDOS {
 
         return future;
     }
+
+    template <typename Function>
+    void FixedThreadPool::parallelFor(std::size_t count, std::size_t chunkSize, Function&& function) {
+        if (count == 0) {
+            return;
+        }
+        chunkSize = std::max<std::size_t>(chunkSize, 1);
+        std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+        struct Progress {
+            std::atomic<std::size_t> next{0};
+            std::atomic<std::size_t> done{0};
+        };
+        // a worker may pick its task up after we returned, it must not touch `function` then.
+        // it doesn't, because it only calls `function` for a chunk it claimed and we wait for all of them.
+        std::shared_ptr<Progress> progress = std::make_shared<Progress>();
+        auto* body = &function;
+        auto work = [progress, body, count, chunkSize, chunkCount]() {
+            std::size_t chunk;
+            while ((chunk = progress->next.fetch_add(1, std::memory_order_relaxed)) < chunkCount) {
+                std::size_t begin = chunk * chunkSize;
+                (*body)(begin, std::min(begin + chunkSize, count));
+                progress->done.fetch_add(1, std::memory_order_release);
+            }
+        };
+
+        std::size_t helperCount = std::min<std::size_t>(mThreadPoolSize, chunkCount - 1);
+        for (std::size_t i = 0; i < helperCount; i++) {
+            mTaskQueue.push(work);
+        }
+        work();
+        while (progress->done.load(std::memory_order_acquire) < chunkCount) {
+            std::this_thread::yield();
+        }
+    }
 }  // namespace GLaDOS
 
 #endif  //GLADOS_FIXEDTHREADPOOL_HPP
@@ -4,6 +4,7 @@
 
 namespace GLaDOS {
     bool JsonParser::parse(JsonNode& value, const std::string& json, std::string& err) {
+        ScopedMemoryTag memoryTag{MemoryTag::Json};
         const char* token = json.c_str();
         err.clear();
 
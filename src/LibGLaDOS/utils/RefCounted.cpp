@@ -13,7 +13,7 @@ namespace GLaDOS {
     }
 
     bool RefCounted::releaseRef() {
-        return mRefCount.fetch_sub(1, std::memory_order_acq_rel) == 0;
+        return mRefCount.fetch_sub(1, std::memory_order_acq_rel) == 1;  // the last reference went away
     }
 
     bool RefCounted::isRefOne() const {
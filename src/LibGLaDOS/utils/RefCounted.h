@@ -19,7 +19,7 @@ namespace GLaDOS {
       private:
         int incrementRefOne();
         int incrementRef(int increment);
-        bool releaseRef();
+        bool releaseRef();  // true when the last reference is released
 
         std::atomic_int mRefCount{0};
     };
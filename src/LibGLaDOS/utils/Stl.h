@@ -12,6 +12,7 @@
 #include <array>
 
 #include "String.hpp"
+#include "memory/MemoryResource.h"
 #include "memory/STLAllocator.h"
 
 namespace GLaDOS {
@@ -63,6 +64,27 @@ namespace GLaDOS {
 
     template <typename T, size_t Size>
     using Array = std::array<T, Size>;
+
+    // Containers whose memory comes from a MemoryResource, e.g. a MonotonicArena scoped to a load.
+    namespace pmr {
+        template <typename T>
+        using Vector = std::vector<T, PolymorphicAllocator<T>>;
+
+        template <typename K, typename V>
+        using Map = std::map<K, V, std::less<K>, PolymorphicAllocator<std::pair<const K, V>>>;
+
+        template <typename K, typename V>
+        using UnorderedMap = std::unordered_map<K, V, HashType<K>, std::equal_to<K>, PolymorphicAllocator<std::pair<const K, V>>>;
+
+        template <typename T>
+        using List = std::list<T, PolymorphicAllocator<T>>;
+
+        template <typename T>
+        using Set = std::set<T, std::less<T>, PolymorphicAllocator<T>>;
+
+        template <typename T>
+        using Deque = std::deque<T, PolymorphicAllocator<T>>;
+    }  // namespace pmr
 }  // namespace GLaDOS
 
 namespace std {
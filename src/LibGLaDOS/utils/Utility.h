@@ -7,6 +7,10 @@
 #include "memory/Allocation.h"
 #include "platform/OSTypes.h"
 
+#if defined(MSVC)
+#include <intrin.h>
+#endif
+
 namespace GLaDOS {
     typedef unsigned long long uint64;
     typedef unsigned int uint32;
@@ -146,6 +150,25 @@ namespace GLaDOS {
     static constexpr T align4(T x) { return (x + 3) >> 2 << 2; }
     template <typename T>
     static constexpr T align8(T x) { return (x + 7) >> 3 << 3; }
+
+    FORCE_INLINE uint32 popCount(uint64 x) {
+#if defined(MSVC)
+        return static_cast<uint32>(__popcnt64(x));
+#else
+        return static_cast<uint32>(__builtin_popcountll(x));
+#endif
+    }
+
+    // index of the lowest set bit, x must not be 0
+    FORCE_INLINE uint32 countTrailingZero(uint64 x) {
+#if defined(MSVC)
+        unsigned long index;
+        _BitScanForward64(&index, x);
+        return static_cast<uint32>(index);
+#else
+        return static_cast<uint32>(__builtin_ctzll(x));
+#endif
+    }
 }  // namespace GLaDOS
 
 #endif
@@ -1,16 +1,112 @@
 #include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
 #include "memory/Allocation.h"
+#include "memory/Blob.h"
+#include "memory/LargeBlockAllocator.h"
 
 using namespace GLaDOS;
 
 TEST_CASE("Allocation unit tests", "[Allocation]") {
   SECTION("calculate minimum size memory aligntment") {
     std::size_t aligned = alignment(sizeof(int32_t) + sizeof(MemBlockDList), _mem_alignment);
-    REQUIRE(aligned == 64);
+    REQUIRE(aligned == sizeof(MemBlockDList) + 64);
   }
 
   SECTION("calculate aligntment size over _mem_alignment size") {
     std::size_t aligned = alignment(60 + sizeof(MemBlockDList), _mem_alignment);
     REQUIRE(aligned == 128);
   }
-}
\ No newline at end of file
+
+  SECTION("payload is aligned to _mem_alignment") {
+    void* ptr = MALLOC(24);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % _mem_alignment == 0);
+    FREE(ptr);
+  }
+
+#if MEMORY_TRACE_ALLOCATION == 1
+  SECTION("call site counters track live blocks") {
+    void* ptr = MALLOC(24);
+    const MemCallSite* site = (reinterpret_cast<MemBlockDList*>(ptr) - 1)->site;
+    REQUIRE(site->liveCount.load() == 1);
+    REQUIRE(site->liveBytes.load() == 24);
+    FREE(ptr);
+    REQUIRE(site->liveCount.load() == 0);
+    REQUIRE(site->liveBytes.load() == 0);
+    REQUIRE(site->totalCount.load() == 1);
+  }
+
+  SECTION("blocks freed by another thread are unlinked from the owner shard") {
+    constexpr int count = 1000;
+    std::vector<void*> blocks(count);
+    std::thread producer([&blocks] {
+      for (auto& block : blocks) {
+        block = MALLOC(16);
+      }
+    });
+    producer.join();
+    const MemCallSite* site = (reinterpret_cast<MemBlockDList*>(blocks[0]) - 1)->site;
+    REQUIRE(site->liveCount.load() == count);
+
+    std::vector<std::thread> consumers;
+    for (int t = 0; t < 4; t++) {
+      consumers.emplace_back([&blocks, t] {
+        for (int i = t; i < count; i += 4) {
+          FREE(blocks[i]);
+        }
+      });
+    }
+    for (auto& consumer : consumers) {
+      consumer.join();
+    }
+    REQUIRE(site->liveCount.load() == 0);
+  }
+
+  SECTION("scoped tag accounts live and peak bytes") {
+    MemTagUsage before = memoryTagUsage(MemoryTag::Audio);
+    void* tagged = nullptr;
+    {
+      ScopedMemoryTag tag{MemoryTag::Audio};
+      REQUIRE(currentMemoryTag() == MemoryTag::Audio);
+      tagged = MALLOC(100);
+    }
+    REQUIRE(currentMemoryTag() == MemoryTag::Untagged);
+    void* explicitTag = MALLOC_TAGGED(50, MemoryTag::Audio);
+    MemTagUsage usage = memoryTagUsage(MemoryTag::Audio);
+    REQUIRE(usage.liveBytes == before.liveBytes + 150);
+    REQUIRE(usage.liveCount == before.liveCount + 2);
+    FREE(tagged);
+    FREE(explicitTag);
+    usage = memoryTagUsage(MemoryTag::Audio);
+    REQUIRE(usage.liveBytes == before.liveBytes);
+    REQUIRE(usage.peakBytes >= before.liveBytes + 150);
+    resetMemoryTagPeak(MemoryTag::Audio);
+    REQUIRE(memoryTagUsage(MemoryTag::Audio).peakBytes == usage.liveBytes);
+  }
+
+  SECTION("budgets are stored per tag") {
+    setMemoryBudget(MemoryTag::Audio, 64, 128);
+    MemTagUsage usage = memoryTagUsage(MemoryTag::Audio);
+    REQUIRE(usage.softBudget == 64);
+    REQUIRE(usage.hardBudget == 128);
+    void* ptr = MALLOC_TAGGED(256, MemoryTag::Audio);
+    REQUIRE(ptr != nullptr);
+    FREE(ptr);
+    setMemoryBudget(MemoryTag::Audio, 0, 0);
+  }
+
+  SECTION("mapped blob storage is accounted to the scoped tag") {
+    MemTagUsage before = memoryTagUsage(MemoryTag::Audio);
+    {
+      Blob blob;
+      {
+        ScopedMemoryTag tag{MemoryTag::Audio};
+        blob.resize(LargeBlockAllocator::threshold());
+      }
+      REQUIRE(blob.isMapped());
+      REQUIRE(memoryTagUsage(MemoryTag::Audio).liveBytes >= before.liveBytes + LargeBlockAllocator::threshold());
+    }
+    REQUIRE(memoryTagUsage(MemoryTag::Audio).liveBytes == before.liveBytes);
+  }
+#endif
+}
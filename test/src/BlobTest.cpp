@@ -1,6 +1,9 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstdio>
+
 #include "memory/Blob.h"
+#include "memory/LargeBlockAllocator.h"
 
 using namespace GLaDOS;
 
@@ -13,4 +16,66 @@ TEST_CASE("Blob unit tests", "[Blob]") {
     sb << i;
     REQUIRE(sb.size() == 4);
   }
+
+  SECTION("large buffer moves to a zero filled mapping") {
+    sb.resize(16);
+    sb.copyFrom(reinterpret_cast<const std::byte*>("0123456789abcdef"), 16);
+    std::size_t large = LargeBlockAllocator::threshold() * 2;
+    sb.resize(large);
+    REQUIRE(sb.isMapped());
+    REQUIRE(sb.size() == large);
+    REQUIRE(sb.pointer()[15] == std::byte{'f'});
+    REQUIRE(sb.pointer()[large - 1] == std::byte{0});
+  }
+
+  SECTION("shrink then grow reads zero past the old size") {
+    std::size_t large = LargeBlockAllocator::threshold() * 2;
+    sb.resize(large);
+    std::fill(sb.pointer(), sb.pointer() + large, std::byte{0xff});
+    sb.resize(100);
+    sb.resize(large);
+    REQUIRE(sb.pointer()[99] == std::byte{0xff});
+    REQUIRE(sb.pointer()[100] == std::byte{0});
+    REQUIRE(sb.pointer()[large - 1] == std::byte{0});
+    sb.clear();
+    REQUIRE(!sb.isMapped());
+    REQUIRE(sb.isEmpty());
+  }
+
+  SECTION("insert and copy across the threshold") {
+    Vector<std::byte> chunk(LargeBlockAllocator::threshold() / 2 + 1, std::byte{7});
+    sb.insertFrom(chunk);
+    sb.insertFrom(chunk);
+    REQUIRE(sb.isMapped());
+    REQUIRE(sb.size() == chunk.size() * 2);
+    Blob copy{sb};
+    REQUIRE(copy.size() == sb.size());
+    REQUIRE(copy.pointer()[copy.size() - 1] == std::byte{7});
+    Blob moved{std::move(copy)};
+    REQUIRE(moved.isMapped());
+    REQUIRE(copy.isEmpty());
+  }
+
+  SECTION("file mapped blob is read only until modified") {
+    const char* path = "blob_map_test.bin";
+    std::FILE* file = std::fopen(path, "wb");
+    REQUIRE(file != nullptr);
+    std::fwrite("hello", 1, 5, file);
+    std::fclose(file);
+
+    REQUIRE(sb.mapFile(path));
+    REQUIRE(sb.isReadOnly());
+    REQUIRE(sb.size() == 5);
+    REQUIRE(static_cast<const char*>(sb.constPointer())[0] == 'h');
+    sb.copyFrom(reinterpret_cast<const std::byte*>("J"), 1);
+    REQUIRE(!sb.isReadOnly());
+    REQUIRE(static_cast<const char*>(sb.constPointer())[0] == 'J');
+
+    REQUIRE(sb.mapFile(path));
+    sb.pointer()[1] = std::byte{'a'};  // writing through pointer() copies the file out first
+    REQUIRE(!sb.isReadOnly());
+    REQUIRE(static_cast<const char*>(sb.constPointer())[1] == 'a');
+    REQUIRE(!sb.mapFile("not_exist_file.bin"));
+    std::remove(path);
+  }
 }
@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Message.h"
+#include "memory/BlobView.h"
+
+using namespace GLaDOS;
+
+TEST_CASE("BlobView unit tests", "[BlobView]") {
+  Blob blob;
+  blob.resize(sizeof(uint32_t) + sizeof(float) + 3);
+  uint32_t u = 7;
+  float f = 1.5f;
+  blob.copyFrom(0, reinterpret_cast<std::byte*>(&u), sizeof(u));
+  blob.copyFrom(sizeof(u), reinterpret_cast<std::byte*>(&f), sizeof(f));
+  blob.copyFrom(sizeof(u) + sizeof(f), reinterpret_cast<const std::byte*>("abc"), 3);
+
+  SECTION("view does not copy") {
+    BlobView view = blob.view();
+    REQUIRE(view.data() == blob.constPointer());
+    REQUIRE(view.size() == blob.size());
+    REQUIRE(*view.as<uint32_t>() == 7);
+    REQUIRE(view.subView(8, 100).size() == 3);
+    REQUIRE(view.subView(100, 1).isEmpty());
+  }
+
+  SECTION("reader reads typed values in order") {
+    BlobReader reader{blob};
+    uint32_t readU = 0;
+    float readF = 0;
+    reader >> readU >> readF;
+    REQUIRE(readU == 7);
+    REQUIRE(readF == 1.5f);
+    BlobView rest = reader.readBytes(3);
+    REQUIRE(static_cast<char>(rest.data()[2]) == 'c');
+    REQUIRE(reader.isEnd());
+    REQUIRE_THROWS_AS(reader.read<uint8_t>(), std::runtime_error);
+    reader.seek(0);
+    REQUIRE(reader.read<uint32_t>() == 7);
+  }
+
+  SECTION("shared copies reference the same bytes until written") {
+    blob.makeShared();
+    Blob copy{blob};
+    REQUIRE(copy.constPointer() == blob.constPointer());
+    REQUIRE(blob.useCount() == 2);
+
+    copy.copyFrom(reinterpret_cast<const std::byte*>("\x09"), 1);
+    REQUIRE(copy.constPointer() != blob.constPointer());
+    REQUIRE(blob.useCount() == 1);
+    REQUIRE(*blob.view().as<uint32_t>() == 7);
+    REQUIRE(static_cast<uint8_t>(copy.view().data()[0]) == 9);
+
+    const void* before = blob.constPointer();
+    REQUIRE(blob.pointer() == before);  // sole owner takes the bytes back without copying
+    REQUIRE(!blob.isShared());
+  }
+
+  SECTION("message copies share payload") {
+    Message msg{MessageType::OnCollisionEnter, blob};
+    Message copy{msg};
+    REQUIRE(copy.view().data() == msg.view().data());
+    BlobReader reader{copy.view()};
+    REQUIRE(reader.read<uint32_t>() == 7);
+  }
+
+  SECTION("small message payloads are kept inline") {
+    uint32_t value = 11;
+    Message msg{MessageType::OnCollisionEnter, &value, sizeof(value)};
+    Message copy{msg};
+    REQUIRE(copy.view().data() != msg.view().data());
+    REQUIRE(*copy.view().as<uint32_t>() == 11);
+    REQUIRE(msg.data() == msg.view().data());
+  }
+}
@@ -0,0 +1,186 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/ComponentStore.hpp"
+#include "core/Scene.h"
+#include "core/component/Camera.h"
+#include "core/component/Transform.h"
+
+using namespace GLaDOS;
+
+class Counter : public Component {
+public:
+  Counter() : Component("Counter") {}
+
+  int mCount{0};
+
+protected:
+  Component* clone() override { return nullptr; }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+  void update([[maybe_unused]] real deltaTime) override { mCount++; }
+  void render() override {}
+};
+
+class Grower : public Component {
+public:
+  Grower() : Component("Grower") {}
+
+protected:
+  Component* clone() override { return nullptr; }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+  void update([[maybe_unused]] real deltaTime) override { gameObject()->addComponent<Counter>(); }
+  void render() override {}
+};
+
+// takes the counters of its object and of its partner, both rows leave the archetype at once
+class Culler : public Component {
+public:
+  Culler() : Component("Culler") {}
+
+  GameObject* mPartner{nullptr};
+
+protected:
+  Component* clone() override { return nullptr; }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+  void update([[maybe_unused]] real deltaTime) override {
+    if (gameObject()->getComponent<Counter>() != nullptr) {
+      gameObject()->removeComponent<Counter>();
+    }
+    if (mPartner->getComponent<Counter>() != nullptr) {
+      mPartner->removeComponent<Counter>();
+    }
+  }
+  void render() override {}
+};
+
+class StoreScene : public Scene {
+public:
+  using Scene::update;
+};
+
+TEST_CASE("ComponentStore unit tests", "[ComponentStore]") {
+  StoreScene scene;
+  scene.getMainCamera()->gameObject()->active(false);
+  GameObject* plain = scene.createGameObject("plain");
+  GameObject* counted = scene.createGameObject("counted");
+  counted->addComponent<Counter>();
+  scene.enableComponentStore();
+  ComponentStore* store = scene.componentStore();
+  REQUIRE(store != nullptr);
+
+  SECTION("objects are grouped by component set") {
+    // camera, transform only, transform + counter
+    REQUIRE(store->archetypeCount() == 3);
+    GameObject* another = scene.createGameObject("another");
+    another->addComponent<Counter>();
+    REQUIRE(store->archetypeCount() == 3);
+
+    int visited = 0;
+    store->forEach<Transform, Counter>([&visited](GameObject* gameObject, Transform& transform, Counter& counter) {
+      REQUIRE(gameObject->transform() == &transform);
+      REQUIRE(gameObject->getComponent<Counter>() == &counter);
+      visited++;
+    });
+    REQUIRE(visited == 2);
+  }
+
+  SECTION("columns follow component type ids") {
+    ComponentTypeId transformId = componentTypeId<Transform>();
+    ComponentTypeId counterId = componentTypeId<Counter>();
+    REQUIRE(transformId == componentTypeId<Transform>());
+    REQUIRE(transformId != counterId);
+
+    ComponentMask signature = (ComponentMask{1} << transformId) | (ComponentMask{1} << counterId);
+    Archetype* archetype = nullptr;
+    for (Archetype* candidate : store->archetypes()) {
+      if (candidate->signature() == signature) {
+        archetype = candidate;
+      }
+    }
+    REQUIRE(archetype != nullptr);
+    REQUIRE(archetype->columnOf(componentTypeId<Camera>()) == -1);
+    REQUIRE(archetype->gameObjectAt(0) == counted);
+    REQUIRE(archetype->column(archetype->columnOf(counterId))[0] == counted->getComponent<Counter>());
+    REQUIRE(archetype->column(archetype->columnOf(transformId))[0] == counted->transform());
+  }
+
+  SECTION("removing a component moves the object") {
+    REQUIRE(counted->removeComponent<Counter>());
+    int visited = 0;
+    store->forEach<Counter>([&visited](GameObject*, Counter&) { visited++; });
+    REQUIRE(visited == 0);
+    store->forEach<Transform>([&visited](GameObject*, Transform&) { visited++; });
+    REQUIRE(visited == 3);
+  }
+
+  SECTION("update runs column by column and skips inactive objects") {
+    GameObject* inactive = scene.createGameObject("inactive");
+    Counter* skipped = inactive->addComponent<Counter>();
+    inactive->active(false);
+    store->update(0.1f);
+    REQUIRE(counted->getComponent<Counter>()->mCount == 1);
+    REQUIRE(skipped->mCount == 0);
+  }
+
+  SECTION("components may add components while they update") {
+    for (int i = 0; i < 50; i++) {
+      scene.createGameObject("grower")->addComponent<Grower>();
+    }
+    std::size_t archetypeCount = store->archetypeCount();
+    store->update(0.1f);
+    REQUIRE(store->archetypeCount() > archetypeCount);
+    int visited = 0;
+    store->forEach<Counter>([&visited](GameObject*, Counter&) { visited++; });
+    REQUIRE(visited == 51);
+  }
+
+  SECTION("components may remove several rows of their archetype while they update") {
+    GameObject* first = scene.createGameObject("first");
+    GameObject* second = scene.createGameObject("second");
+    for (GameObject* gameObject : {first, second}) {
+      gameObject->addComponent<Counter>();
+      gameObject->addComponent<Culler>();
+    }
+    first->getComponent<Culler>()->mPartner = second;
+    second->getComponent<Culler>()->mPartner = first;
+    store->update(0.1f);
+    REQUIRE(first->getComponent<Counter>() == nullptr);
+    REQUIRE(second->getComponent<Counter>() == nullptr);
+    REQUIRE(first->getComponent<Culler>() != nullptr);
+  }
+
+  SECTION("sleeping objects leave the awake rows of their archetype") {
+    GameObject* sleeper = scene.createGameObject("sleeper");
+    Counter* sleeping = sleeper->addComponent<Counter>();
+    Archetype* archetype = nullptr;
+    for (Archetype* candidate : store->archetypes()) {
+      if (candidate->columnOf(componentTypeId<Counter>()) != -1) {
+        archetype = candidate;
+      }
+    }
+    REQUIRE(archetype != nullptr);
+    REQUIRE(archetype->awakeCount() == 2);
+
+    sleeper->transform()->setLocalPosition(Vec3{1, 0, 0});
+    sleeping->sleep();
+    counted->getComponent<Counter>()->sleep();
+    counted->getComponent<Counter>()->wake();
+    scene.update(0.1f);
+    REQUIRE(archetype->awakeCount() == 1);
+    REQUIRE(archetype->gameObjectAt(0) == counted);
+    REQUIRE(counted->getComponent<Counter>()->mCount == 1);
+    REQUIRE(sleeping->mCount == 0);
+
+    sleeping->wake();
+    scene.update(0.1f);
+    REQUIRE(archetype->awakeCount() == 2);
+    REQUIRE(sleeping->mCount == 1);
+  }
+
+  SECTION("destroyed objects leave the store") {
+    REQUIRE(scene.destroyImmediate(counted));
+    int visited = 0;
+    store->forEach<Counter>([&visited](GameObject*, Counter&) { visited++; });
+    REQUIRE(visited == 0);
+    REQUIRE(plain->transform() != nullptr);
+  }
+}
@@ -2,6 +2,8 @@
 
 #include "memory/FixedSizeMemoryPool.hpp"
 #include "memory/ThreadLocalAllocator.hpp"
+#include "utils/ConcurrentQueue.hpp"
+#include <atomic>
 #include <thread>
 
 using namespace GLaDOS;
@@ -32,6 +34,56 @@ TEST_CASE("FixedSizeMemoryPool unit tests", "[FixedSizeMemoryPool]") {
     personPool.deallocate(p2);
   }
 
+  SECTION("pool grows by chunk on demand") {
+    FixedSizeMemoryPool<Person> personPool{4};
+    REQUIRE(personPool.chunkCount() == 0);
+
+    Person* persons[9];
+    for (int i = 0; i < 9; i++) {
+      persons[i] = personPool.allocate(i, "Peter", "brown");
+      REQUIRE(persons[i] != nullptr);
+    }
+    REQUIRE(personPool.chunkCount() == 3);
+    REQUIRE(personPool.capacity() == 12);
+    REQUIRE(personPool.liveCount() == 9);
+    for (int i = 0; i < 9; i++) {
+      REQUIRE(persons[i]->mAge == i);
+      personPool.deallocate(persons[i]);
+    }
+    REQUIRE(personPool.liveCount() == 0);
+  }
+
+  SECTION("release empty chunks") {
+    FixedSizeMemoryPool<Person> personPool{2};
+    Person* persons[6];
+    for (auto& person : persons) {
+      person = personPool.allocate(18, "Peter", "brown");
+    }
+    REQUIRE(personPool.chunkCount() == 3);
+
+    // empty first and last chunks, keep one block alive in the middle chunk
+    personPool.deallocate(persons[0]);
+    personPool.deallocate(persons[1]);
+    personPool.deallocate(persons[2]);
+    personPool.deallocate(persons[4]);
+    personPool.deallocate(persons[5]);
+    REQUIRE(personPool.releaseEmptyChunks() == 2);
+    REQUIRE(personPool.chunkCount() == 1);
+    REQUIRE(persons[3]->mAge == 18);
+
+    // the remaining free block is reused before growing again
+    Person* reused = personPool.allocate(20, "Alice", "blond");
+    REQUIRE(personPool.chunkCount() == 1);
+    Person* grown = personPool.allocate(21, "Bob", "black");
+    REQUIRE(personPool.chunkCount() == 2);
+
+    personPool.deallocate(reused);
+    personPool.deallocate(grown);
+    personPool.deallocate(persons[3]);
+    REQUIRE(personPool.releaseEmptyChunks() == 2);
+    REQUIRE(personPool.capacity() == 0);
+  }
+
   SECTION("thread local allocator test") {
     ThreadLocalAllocator<Person> tlsPool;
     std::function<void(int)> fn = [&tlsPool](int count) {
@@ -57,4 +109,125 @@ TEST_CASE("FixedSizeMemoryPool unit tests", "[FixedSizeMemoryPool]") {
     t1.join();
     t2.join();
   }
-}
\ No newline at end of file
+
+  SECTION("remote deallocation is reclaimed by owner") {
+    constexpr int count = 256;
+    FixedSizeMemoryPool<Person> personPool{16};
+    Vector<Person*> persons(count);
+    for (int i = 0; i < count; i++) {
+      persons[i] = personPool.allocate(i, "Peter", "brown");
+    }
+    std::size_t chunkCount = personPool.chunkCount();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+      threads.emplace_back([&personPool, &persons, t] {
+        for (int i = t; i < count; i += 4) {
+          personPool.deallocateRemote(persons[i]);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    for (int i = 0; i < count; i++) {
+      persons[i] = personPool.allocate(i, "Alice", "blond");
+    }
+    REQUIRE(personPool.chunkCount() == chunkCount);
+    REQUIRE(personPool.liveCount() == count);
+    for (auto& person : persons) {
+      personPool.deallocate(person);
+    }
+  }
+
+  SECTION("remote deallocation overlaps with owner allocation") {
+    constexpr int freerCount = 3;
+    constexpr int total = 20000;
+    FixedSizeMemoryPool<Person> personPool{64};
+    ConcurrentQueue<Person*> queue;
+    std::atomic<int> freed{0};
+    std::atomic<bool> corrupted{false};
+
+    // freers push blocks to the remote list while the owner keeps allocating, which drains it
+    std::vector<std::thread> freers;
+    for (int f = 0; f < freerCount; f++) {
+      freers.emplace_back([&personPool, &queue, &freed, &corrupted] {
+        Person* person = nullptr;
+        while (freed.load() < total) {
+          if (!queue.tryPop(person)) {
+            std::this_thread::yield();
+            continue;
+          }
+          if (person->mName != "Peter" || person->mHairColor != "brown") {
+            corrupted = true;
+          }
+          personPool.deallocateRemote(person);
+          freed++;
+        }
+      });
+    }
+
+    for (int i = 0; i < total; i++) {
+      queue.push(personPool.allocate(i, "Peter", "brown"));
+    }
+    for (auto& freer : freers) {
+      freer.join();
+    }
+
+    REQUIRE_FALSE(corrupted.load());
+    personPool.releaseEmptyChunks();
+    REQUIRE(personPool.liveCount() == 0);
+    REQUIRE(personPool.capacity() == 0);
+  }
+
+  SECTION("thread local allocator cross thread deallocation stress test") {
+    constexpr int producerCount = 2;
+    constexpr int consumerCount = 3;
+    constexpr int itemsPerProducer = 5000;
+    ThreadLocalAllocator<Person> tlsPool;
+    ConcurrentQueue<Person*> queue;
+    std::atomic<int> consumed{0};
+    std::atomic<bool> corrupted{false};
+
+    // producers stay alive until every object is consumed because the owning pool must outlive its objects
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producerCount; p++) {
+      producers.emplace_back([&tlsPool, &queue, &consumed] {
+        for (int i = 0; i < itemsPerProducer; i++) {
+          queue.push(tlsPool.allocate(i, "Peter", "brown"));
+        }
+        while (consumed.load() < producerCount * itemsPerProducer) {
+          std::this_thread::yield();
+        }
+      });
+    }
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < consumerCount; c++) {
+      consumers.emplace_back([&tlsPool, &queue, &consumed, &corrupted] {
+        Person* person = nullptr;
+        while (consumed.load() < producerCount * itemsPerProducer) {
+          if (!queue.tryPop(person)) {
+            std::this_thread::yield();
+            continue;
+          }
+          if (person->mName != "Peter" || person->mHairColor != "brown") {
+            corrupted = true;
+          }
+          tlsPool.deallocate(person);
+          consumed++;
+        }
+      });
+    }
+
+    for (auto& consumer : consumers) {
+      consumer.join();
+    }
+    for (auto& producer : producers) {
+      producer.join();
+    }
+    REQUIRE(consumed.load() == producerCount * itemsPerProducer);
+    REQUIRE_FALSE(corrupted.load());
+  }
+}
@@ -28,4 +28,18 @@ TEST_CASE("FixedThreadPool unit tests", "[FixedThreadPool]") {
     }
     REQUIRE(testSuite.size() == 100 * poolSize);
   }
-}
\ No newline at end of file
+
+  SECTION("ThreadPool parallelFor visits every index once") {
+    FixedThreadPool pool{4};
+    std::vector<std::atomic<int>> visits(1000);
+    pool.parallelFor(visits.size(), 64, [&visits](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; i++) {
+        visits[i].fetch_add(1);
+      }
+    });
+    for (auto& visit : visits) {
+      REQUIRE(visit.load() == 1);
+    }
+    pool.parallelFor(0, 64, [](std::size_t, std::size_t) { FAIL("no chunk for an empty range"); });
+  }
+}
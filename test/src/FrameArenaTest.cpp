@@ -0,0 +1,48 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "memory/FrameArena.h"
+
+using namespace GLaDOS;
+
+TEST_CASE("FrameArena unit tests", "[FrameArena]") {
+  FrameArena arena{1024};
+
+  SECTION("allocation respects alignment") {
+    void* p1 = arena.allocate(3, 1);
+    void* p2 = arena.allocate(sizeof(double), alignof(double));
+    REQUIRE(p1 != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p2) % alignof(double) == 0);
+    REQUIRE(arena.usedBytes() == 16);
+  }
+
+  SECTION("previous frame memory survives one swap") {
+    int* value = static_cast<int*>(arena.allocate(sizeof(int), alignof(int)));
+    *value = 42;
+    arena.swapBuffers();
+    REQUIRE(arena.usedBytes() == 0);
+    arena.allocate(sizeof(int), alignof(int));
+    REQUIRE(*value == 42);
+    arena.swapBuffers();
+    REQUIRE(arena.usedBytes() == 0);
+  }
+
+  SECTION("overflow falls back to heap until reset") {
+    arena.allocate(1000, 1);
+    void* big = arena.allocate(512, 16);
+    REQUIRE(big != nullptr);
+    REQUIRE(arena.overflowCount() == 1);
+    arena.swapBuffers();
+    arena.swapBuffers();
+    REQUIRE(arena.overflowCount() == 0);
+  }
+
+  SECTION("frame vector") {
+    FrameVector<int> vec{FrameAllocator<int>{arena}};
+    for (int i = 0; i < 10; i++) {
+      vec.push_back(i);
+    }
+    REQUIRE(vec.size() == 10);
+    REQUIRE(vec[9] == 9);
+    REQUIRE(arena.usedBytes() > 0);
+  }
+}
@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/component/Transform.h"
+#include "memory/HandlePool.hpp"
+
+using namespace GLaDOS;
+
+struct PooledValue {
+  PooledValue(int v) : value{v} {}
+  int value;
+};
+
+TEST_CASE("HandlePool unit tests", "[HandlePool]") {
+  HandlePool<PooledValue> pool;
+
+  SECTION("resolve live handle") {
+    PooledValue* object = pool.create(42);
+    Handle<PooledValue> handle = pool.handleOf(object);
+    REQUIRE(!handle.isNull());
+    REQUIRE(pool.resolve(handle) == object);
+    REQUIRE(pool.resolve(handle)->value == 42);
+    REQUIRE(pool.size() == 1);
+  }
+
+  SECTION("stale handle is detected after slot reuse") {
+    PooledValue* first = pool.create(1);
+    Handle<PooledValue> stale = pool.handleOf(first);
+    pool.destroy(first);
+    REQUIRE(pool.resolve(stale) == nullptr);
+    REQUIRE(!pool.destroy(stale));
+
+    PooledValue* second = pool.create(2);
+    Handle<PooledValue> fresh = pool.handleOf(second);
+    REQUIRE(second == first);  // slot is reused
+    REQUIRE(fresh.index() == stale.index());
+    REQUIRE(fresh.generation() != stale.generation());
+    REQUIRE(pool.resolve(stale) == nullptr);
+    REQUIRE(pool.resolve(fresh) == second);
+  }
+
+  SECTION("null and out of range handles") {
+    REQUIRE(pool.resolve(Handle<PooledValue>{}) == nullptr);
+    REQUIRE(pool.resolve(Handle<PooledValue>{1000, 1}) == nullptr);
+  }
+
+  SECTION("objects are packed in chunks") {
+    Vector<PooledValue*> objects;
+    for (uint32_t i = 0; i < HandlePool<PooledValue>::chunkSize + 1; i++) {
+      objects.push_back(pool.create(static_cast<int>(i)));
+    }
+    REQUIRE(pool.capacity() == HandlePool<PooledValue>::chunkSize * 2);
+    int sum = 0;
+    pool.forEach([&sum](PooledValue& object) {
+      sum += object.value;
+    });
+    REQUIRE(sum == static_cast<int>(HandlePool<PooledValue>::chunkSize * (HandlePool<PooledValue>::chunkSize + 1) / 2));
+  }
+
+  SECTION("reserved chunks are filled before growing") {
+    REQUIRE(pool.reserve(HandlePool<PooledValue>::chunkSize + 1));
+    REQUIRE(pool.capacity() == HandlePool<PooledValue>::chunkSize * 2);
+    for (uint32_t i = 0; i < HandlePool<PooledValue>::chunkSize * 2; i++) {
+      REQUIRE(pool.create(static_cast<int>(i)) != nullptr);
+    }
+    REQUIRE(pool.capacity() == HandlePool<PooledValue>::chunkSize * 2);
+  }
+
+  SECTION("scene objects and components go stale on destroy") {
+    Scene scene;
+    GameObject* parent = scene.createGameObject("parent");
+    GameObject* child = scene.createGameObject("child", parent);
+    Handle<GameObject> parentHandle = parent->handle();
+    Handle<GameObject> childHandle = child->handle();
+    Handle<Transform> transformHandle = child->getComponentHandle<Transform>();
+    REQUIRE(resolve(childHandle) == child);
+    REQUIRE(resolve(transformHandle) == child->transform());
+
+    REQUIRE(scene.destroyImmediate(parent));
+    REQUIRE(resolve(parentHandle) == nullptr);
+    REQUIRE(resolve(childHandle) == nullptr);
+    REQUIRE(resolve(transformHandle) == nullptr);
+  }
+}
@@ -0,0 +1,103 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/SceneManager.h"
+#include "core/component/renderer/MeshRenderer.h"
+#include "platform/HeadlessRunner.h"
+#include "platform/Platform.h"
+#include "platform/Timer.h"
+#include "platform/render/Material.h"
+#include "platform/render/Mesh.h"
+#include "platform/render/Renderable.h"
+#include "platform/render/ShaderProgram.h"
+#include "platform/render/Texture2D.h"
+#include "platform/render/VertexBuffer.h"
+#include "platform/render/null/NullRenderer.h"
+#include "resource/ResourceManager.h"
+
+using namespace GLaDOS;
+
+class HeadlessScene : public Scene {
+public:
+  bool onInit() override {
+    createGameObject("drawn")->addComponent<MeshRenderer>();
+    return true;
+  }
+
+  void onUpdate(real deltaTime) override {
+    mFrames++;
+    mTime += deltaTime;
+  }
+
+  void onFixedUpdate([[maybe_unused]] real fixedDeltaTime) override { mFixedSteps++; }
+
+  int mFrames{0};
+  int mFixedSteps{0};
+  real mTime{0};
+};
+
+TEST_CASE("HeadlessRunner unit tests", "[HeadlessRunner]") {
+  REQUIRE(Platform::getInstance().initializeHeadless(800, 600));
+  REQUIRE(Platform::isHeadless());
+  REQUIRE(&Platform::getRenderer() == &NullRenderer::getInstance());
+
+  SceneManager& manager = SceneManager::getInstance();
+  static auto* scene = static_cast<HeadlessScene*>(manager.createScene<HeadlessScene>("headless"));
+  REQUIRE(scene != nullptr);
+  Scene* previous = manager.activeScene();
+  REQUIRE(manager.setActiveScene(scene));
+  scene->mFrames = 0;
+  scene->mFixedSteps = 0;
+  scene->mTime = 0;
+  Timer::getInstance().reset();
+  std::size_t renderCount = NullRenderer::getInstance().renderCount();
+
+  SECTION("a fixed rate run is deterministic") {
+    HeadlessParams params;
+    params.frameCount = 100;
+    params.frameTime = Timer::getInstance().fixedDeltaTime() / 2;
+    params.printStatistics = false;
+    FrameStatistics statistics = HeadlessRunner::run(params);
+
+    REQUIRE(statistics.frameCount == 100);
+    REQUIRE(scene->mFrames == 100);
+    REQUIRE(statistics.fixedStepCount == static_cast<uint32_t>(scene->mFixedSteps));
+    REQUIRE(scene->mFixedSteps >= 49);
+    REQUIRE(scene->mFixedSteps <= 50);
+    REQUIRE(NullRenderer::getInstance().renderCount() - renderCount == 100);
+    REQUIRE(statistics.minFrameTime <= statistics.medianFrameTime);
+    REQUIRE(statistics.medianFrameTime <= statistics.p99FrameTime);
+    REQUIRE(statistics.p99FrameTime <= statistics.maxFrameTime);
+  }
+
+  SECTION("an unlocked run advances by the measured frame time") {
+    HeadlessParams params;
+    params.frameCount = 10;
+    FrameStatistics statistics = HeadlessRunner::run(params);
+    REQUIRE(statistics.frameCount == 10);
+    REQUIRE(scene->mFrames == 10);
+    REQUIRE(scene->mTime > 0);
+  }
+
+  SECTION("resources of the NullRenderer accept uploads") {
+    Renderer& renderer = Platform::getRenderer();
+    Mesh mesh{"headless"};
+    REQUIRE(mesh.build(NEW_T(VertexBuffer(VertexFormatDescriptor().position(), 4)), nullptr));
+    ShaderProgram* shaderProgram = renderer.createShaderProgramFromFile("vertex", "fragment", nullptr);
+    REQUIRE(shaderProgram != nullptr);
+    shaderProgram->setUniform("flipX", true);
+    Renderable* renderable = renderer.createRenderable(&mesh, NEW_T(Material(shaderProgram)));
+    REQUIRE(renderable != nullptr);
+    REQUIRE(renderable->getMaterial()->getShaderProgram() == shaderProgram);
+    DELETE_T(renderable, Renderable);
+    Texture2D* texture = renderer.createTexture2D("headless", PixelFormat::RGBA32);
+    REQUIRE(texture != nullptr);
+    REQUIRE(ResourceManager::getInstance().remove(texture));
+    DELETE_T(texture, Texture2D);
+  }
+
+  if (previous != nullptr) {
+    manager.setActiveScene(previous);
+  }
+}
@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include <array>
+#include <cmath>
 
 #include "math/Mat4.hpp"
 
@@ -229,4 +230,57 @@ TEST_CASE("Matrix unit tests", "[Matrix]") {
       // 3. Row-addition transformations
       Mat4<real> em3 = Mat4<real>::elementary3(2, 3.f, 1);
   }
+
+  SECTION("float kernels match hand computed results") {
+    Mat4<real> a{
+        -3.F, -1.F, 2.F, -3.F,
+        -3.F, 1.F, 2.F, -2.F,
+        -2.F, 3.F, 0.F, 1.F,
+        1.F, -2.F, -3.F, 1.F};
+    // scale (2, 1, 0.5), 90 degrees about z, then translate (1, -2, 3)
+    Mat4<real> b{
+        0.F, 2.F, 0.F, 0.F,
+        -1.F, 0.F, 0.F, 0.F,
+        0.F, 0.F, 0.5F, 0.F,
+        1.F, -2.F, 3.F, 1.F};
+    Mat4<real> ab{
+        -2.F, 0.F, -8.F, -3.F,
+        -3.F, -2.F, -5.F, -2.F,
+        -2.F, -6.F, 3.F, 1.F,
+        3.F, 0.F, 1.5F, 1.F};
+    Mat4<real> aa{
+        5.F, 14.F, 1.F, 10.F,
+        0.F, 14.F, 2.F, 7.F,
+        -2.F, 3.F, -1.F, 1.F,
+        10.F, -14.F, -5.F, -1.F};
+    Mat4<real> transposedA{
+        -3.F, -3.F, -2.F, 1.F,
+        -1.F, 1.F, 3.F, -2.F,
+        2.F, 2.F, 0.F, -3.F,
+        -3.F, -2.F, 1.F, 1.F};
+    Mat4<real> inverseB{
+        0.F, -1.F, 0.F, 0.F,
+        0.5F, 0.F, 0.F, 0.F,
+        0.F, 0.F, 2.F, 0.F,
+        1.F, 1.F, -6.F, 1.F};
+    auto near = [](const Mat4<real>& value, const Mat4<real>& expected) {
+      for (unsigned i = 0; i < 16; i++) {
+        if (std::abs(value[i] - expected[i]) > 1e-4f) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    REQUIRE(near(a * b, ab));
+    Mat4<real> self = a;
+    self *= self;
+    REQUIRE(near(self, aa));
+    REQUIRE(near(Mat4<real>::transpose(a), transposedA));
+    REQUIRE(near(Mat4<real>::inverse(b), inverseB));
+    REQUIRE(near(Mat4<real>::inverseAffine(b), inverseB));
+    REQUIRE(near(b * inverseB, Mat4<real>::identity()));
+    REQUIRE(Mat4<real>::inverse(Mat4<real>::zero()) == Mat4<real>::identity());
+    REQUIRE(Mat4<real>::inverseAffine(Mat4<real>::zero()) == Mat4<real>::identity());
+  }
 }
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/Stl.h"
+
+using namespace GLaDOS;
+
+class CountingResource : public MemoryResource {
+public:
+  void* allocate(std::size_t bytes, std::size_t align) override {
+    if (exhausted) {
+      return nullptr;
+    }
+    allocations++;
+    allocatedAlign += align;
+    return defaultMemoryResource()->allocate(bytes, align);
+  }
+  void deallocate(void* ptr, std::size_t bytes, std::size_t align) override {
+    deallocations++;
+    deallocatedAlign += align;
+    defaultMemoryResource()->deallocate(ptr, bytes, align);
+  }
+
+  bool exhausted = false;
+  int allocations = 0;
+  int deallocations = 0;
+  std::size_t allocatedAlign = 0;
+  std::size_t deallocatedAlign = 0;
+};
+
+TEST_CASE("MemoryResource unit tests", "[MemoryResource]") {
+  CountingResource upstream;
+
+  SECTION("arena bumps inside chunks and respects alignment") {
+    MonotonicArena arena{256, &upstream};
+    void* p1 = arena.allocate(3, 1);
+    void* p2 = arena.allocate(sizeof(double), alignof(double));
+    void* p3 = arena.allocate(64, 64);
+    REQUIRE(p1 != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p2) % alignof(double) == 0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p3) % 64 == 0);
+    REQUIRE(arena.chunkCount() == 1);
+    REQUIRE(arena.usedBytes() == 3 + sizeof(double) + 64);
+  }
+
+  SECTION("oversized request gets its own chunk") {
+    MonotonicArena arena{256, &upstream};
+    void* big = arena.allocate(10000, 16);
+    REQUIRE(big != nullptr);
+    REQUIRE(arena.chunkCount() == 1);
+    arena.allocate(16, 16);
+    REQUIRE(arena.chunkCount() == 2);
+  }
+
+  SECTION("over-aligned chunks are released with their alignment") {
+    MonotonicArena arena{256, &upstream};
+    arena.allocate(16, 16);
+    void* p = arena.allocate(512, 256);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p) % 256 == 0);
+    arena.release();
+    REQUIRE(upstream.deallocations == upstream.allocations);
+    REQUIRE(upstream.deallocatedAlign == upstream.allocatedAlign);
+  }
+
+  SECTION("arena fails cleanly when the upstream is exhausted") {
+    MonotonicArena arena{256, &upstream};
+    REQUIRE(arena.allocate(16, 16) != nullptr);
+    upstream.exhausted = true;
+    REQUIRE(arena.allocate(10000, 16) == nullptr);
+    REQUIRE(arena.chunkCount() == 1);
+    REQUIRE(arena.usedBytes() == 16);
+    REQUIRE(arena.allocate(16, 16) != nullptr);
+    arena.release();
+    REQUIRE(upstream.deallocations == upstream.allocations);
+  }
+
+  SECTION("release returns every chunk at once") {
+    {
+      MonotonicArena arena{256, &upstream};
+      pmr::Vector<int> vec{&arena};
+      for (int i = 0; i < 1000; i++) {
+        vec.push_back(i);
+      }
+      REQUIRE(vec[999] == 999);
+      REQUIRE(upstream.allocations == static_cast<int>(arena.chunkCount()));
+      arena.release();
+      REQUIRE(arena.chunkCount() == 0);
+      REQUIRE(upstream.deallocations == upstream.allocations);
+    }
+    REQUIRE(upstream.deallocations == upstream.allocations);
+  }
+
+  SECTION("nested containers inherit the arena") {
+    MonotonicArena arena{256, &upstream};
+    pmr::Vector<pmr::Vector<int>> outer{&arena};
+    outer.emplace_back();
+    outer.back().push_back(1);
+    REQUIRE(outer.back().get_allocator().resource() == &arena);
+
+    pmr::Map<int, int> map{&arena};
+    map[1] = 2;
+    REQUIRE(map.get_allocator().resource() == &arena);
+  }
+
+  SECTION("copies fall back to default resource") {
+    MonotonicArena arena{256, &upstream};
+    pmr::Vector<int> vec{&arena};
+    vec.push_back(1);
+    pmr::Vector<int> copy{vec};
+    REQUIRE(copy.get_allocator().resource() == defaultMemoryResource());
+    REQUIRE(copy.get_allocator() != vec.get_allocator());
+    REQUIRE(copy[0] == 1);
+  }
+
+  SECTION("default resource round trip") {
+    pmr::Vector<std::size_t> vec;
+    for (std::size_t i = 0; i < 100; i++) {
+      vec.push_back(i);
+    }
+    REQUIRE(vec.get_allocator().resource() == defaultMemoryResource());
+    REQUIRE(vec[99] == 99);
+  }
+}
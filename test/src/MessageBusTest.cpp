@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+#include "core/MessageBus.hpp"
+#include "core/Scene.h"
+
+using namespace GLaDOS;
+
+struct Impact {
+  int order;
+  real impulse;
+};
+
+class ImpactReceiver : public Component {
+public:
+  ImpactReceiver() : Component("ImpactReceiver") {}
+
+  Vector<int> mOrders;
+  real mImpulse{0};
+
+protected:
+  MessageResult handleMessage(Message& msg) override {
+    Impact impact = BlobReader{msg.view()}.read<Impact>();
+    mOrders.push_back(impact.order);
+    mImpulse += impact.impulse;
+    return MessageResult::True;
+  }
+  Component* clone() override { return nullptr; }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+  void update([[maybe_unused]] real deltaTime) override {}
+  void render() override {}
+};
+
+class ImpactRemover : public Component {
+public:
+  ImpactRemover() : Component("ImpactRemover") {}
+
+  int mHandled{0};
+
+protected:
+  MessageResult handleMessage([[maybe_unused]] Message& msg) override {
+    mHandled++;
+    // removes a subscriber which is not delivered yet and grows the subscriber lists
+    if (gameObject()->getComponent<ImpactReceiver>() != nullptr) {
+      gameObject()->removeComponent<ImpactReceiver>();
+    }
+    gameObject()->subscribeAllMessageType<ImpactRemover>();
+    return MessageResult::True;
+  }
+  Component* clone() override { return nullptr; }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+  void update([[maybe_unused]] real deltaTime) override {}
+  void render() override {}
+};
+
+TEST_CASE("MessageBus unit tests", "[MessageBus]") {
+  Scene scene;
+  MessageBus* bus = scene.messageBus();
+  GameObject* first = scene.createGameObject("first");
+  GameObject* second = scene.createGameObject("second");
+  ImpactReceiver* firstReceiver = first->addComponent<ImpactReceiver>();
+  ImpactReceiver* secondReceiver = second->addComponent<ImpactReceiver>();
+  first->subscribeToMessageType<ImpactReceiver>(MessageType::OnCollisionEnter);
+  second->subscribeToMessageType<ImpactReceiver>(MessageType::OnCollisionEnter);
+
+  SECTION("messages are queued until dispatch and keep order per receiver") {
+    bus->post(first, MessageType::OnCollisionEnter, Impact{0, 1});
+    bus->post(second, MessageType::OnCollisionEnter, Impact{1, 2});
+    bus->post(first, MessageType::OnCollisionEnter, Impact{2, 3});
+    bus->post(first, MessageType::OnCollisionExit, Impact{3, 4});  // not subscribed
+    REQUIRE(firstReceiver->mOrders.empty());
+    REQUIRE(bus->pendingCount() == 4);
+
+    REQUIRE(bus->dispatch() == 4);
+    REQUIRE(firstReceiver->mOrders == Vector<int>{0, 2});
+    REQUIRE(secondReceiver->mOrders == Vector<int>{1});
+    REQUIRE(firstReceiver->mImpulse == 4);
+    REQUIRE(bus->pendingCount() == 0);
+  }
+
+  SECTION("messages to destroyed receivers are dropped") {
+    bus->post(second, MessageType::OnCollisionEnter, Impact{0, 1});
+    REQUIRE(scene.destroyImmediate(second));
+    REQUIRE(bus->dispatch() == 0);
+  }
+
+  SECTION("workers post concurrently") {
+    std::vector<std::thread> workers;
+    for (int worker = 0; worker < 4; worker++) {
+      workers.emplace_back([bus, first, worker]() {
+        for (int i = 0; i < 100; i++) {
+          bus->postConcurrent(first, MessageType::OnCollisionEnter, Impact{worker, 1});
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    REQUIRE(bus->dispatch() == 400);
+    REQUIRE(firstReceiver->mImpulse == 400);
+  }
+
+  SECTION("handlers may remove subscribers of the message being delivered") {
+    GameObject* third = scene.createGameObject("third");
+    ImpactRemover* remover = third->addComponent<ImpactRemover>();
+    third->addComponent<ImpactReceiver>();
+    third->subscribeToMessageType<ImpactRemover>(MessageType::OnCollisionEnter);
+    third->subscribeToMessageType<ImpactReceiver>(MessageType::OnCollisionEnter);
+    bus->post(third, MessageType::OnCollisionEnter, Impact{0, 1});
+    bus->post(third, MessageType::OnCollisionEnter, Impact{1, 1});
+    REQUIRE(bus->dispatch() == 2);
+    REQUIRE(remover->mHandled == 2);
+    REQUIRE(third->getComponent<ImpactReceiver>() == nullptr);
+  }
+}
@@ -3,9 +3,12 @@
 
 using namespace GLaDOS;
 
+static int destroyedCount = 0;
+
 class TestSuiteObject : public RefCounted {
 public:
   TestSuiteObject(const std::string& n) : name{n} {}
+  ~TestSuiteObject() override { destroyedCount++; }
   std::string getname() const { return name; }
 
 private:
@@ -18,4 +21,18 @@ TEST_CASE("RefPtr unit tests", "[RefPtr]") {
     REQUIRE(pTestSuite->getname() == "testme");
     REQUIRE(pTestSuite->isRefOne() == true);
   }
+
+  SECTION("the object is deleted with the last reference") {
+    destroyedCount = 0;
+    {
+      RefPtr<TestSuiteObject> first(NEW_T(TestSuiteObject("shared")));
+      {
+        RefPtr<TestSuiteObject> second = first;
+        REQUIRE_FALSE(first->isRefOne());
+      }
+      REQUIRE(destroyedCount == 0);
+      REQUIRE(first->isRefOne());
+    }
+    REQUIRE(destroyedCount == 1);
+  }
 }
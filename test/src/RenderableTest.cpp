@@ -0,0 +1,38 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "platform/render/Material.h"
+#include "platform/render/Renderable.h"
+
+using namespace GLaDOS;
+
+static int releasedMaterials = 0;
+
+class CountedMaterial : public Material {
+public:
+  ~CountedMaterial() override { releasedMaterials++; }
+};
+
+class TestRenderable : public Renderable {
+public:
+  explicit TestRenderable(Material* material) { mMaterial = material; }
+
+  void build() override {}
+  void bindParams() override {}
+};
+
+TEST_CASE("Renderable unit tests", "[Renderable]") {
+  releasedMaterials = 0;
+
+  SECTION("a shared material is released with the last renderable") {
+    Material* material = NEW_T(CountedMaterial);
+    Renderable* first = NEW_T(TestRenderable)(material);
+    Renderable* second = NEW_T(TestRenderable)(material);
+    REQUIRE(first->getMaterial() == second->getMaterial());
+
+    DELETE_T(first, Renderable);
+    REQUIRE(releasedMaterials == 0);
+    REQUIRE(second->getMaterial() == material);
+    DELETE_T(second, Renderable);
+    REQUIRE(releasedMaterials == 1);
+  }
+}
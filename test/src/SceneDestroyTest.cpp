@@ -0,0 +1,43 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+
+using namespace GLaDOS;
+
+TEST_CASE("Scene destroy unit tests", "[SceneDestroy]") {
+  Scene scene;
+  std::size_t initialCount = scene.gameObjectCount();  // main camera
+  GameObject* parent = scene.createGameObject("parent");
+  GameObject* child = scene.createGameObject("child", parent);
+  GameObject* other = scene.createGameObject("other");
+  Handle<GameObject> childHandle = child->handle();
+
+  SECTION("destroy is deferred until the queue is flushed") {
+    REQUIRE(scene.destroy(parent));
+    REQUIRE(scene.destroy(parent));  // queued once
+    REQUIRE(parent->isPendingDestroy());
+    REQUIRE(scene.contains(child));
+    REQUIRE(scene.gameObjectCount() == initialCount + 3);
+
+    scene.flushDestroyQueue();
+    REQUIRE(scene.gameObjectCount() == initialCount + 1);
+    REQUIRE(resolve(childHandle) == nullptr);
+    REQUIRE(scene.contains(other));
+  }
+
+  SECTION("immediate destroy of a queued child leaves no dangling entry") {
+    REQUIRE(scene.destroy(child));
+    REQUIRE(scene.destroy(parent));
+    REQUIRE(scene.destroyImmediate(child));
+    scene.flushDestroyQueue();
+    REQUIRE(scene.gameObjectCount() == initialCount + 1);
+  }
+
+  SECTION("objects of another scene are rejected") {
+    Scene another;
+    REQUIRE_FALSE(another.destroy(other));
+    REQUIRE_FALSE(another.destroyImmediate(other));
+    REQUIRE(scene.contains(other));
+  }
+}
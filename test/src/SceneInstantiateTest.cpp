@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/component/Transform.h"
+#include "core/component/renderer/SkinnedMeshRenderer.h"
+
+using namespace GLaDOS;
+
+TEST_CASE("Scene instantiate unit tests", "[SceneInstantiate]") {
+  Scene scene;
+  GameObject* prefab = scene.createGameObject("prefab");
+  GameObject* child = scene.createGameObject("child", prefab);
+  scene.createGameObject("grandchild", child);
+  prefab->transform()->setLocalPosition(Vec3{1, 0, 0});
+  std::size_t initialCount = scene.gameObjectCount();
+
+  SECTION("children of a clone belong to the clone") {
+    GameObject* clone = scene.instantiate(prefab);
+    REQUIRE(prefab->getChildren().size() == 1);
+    REQUIRE(child->getChildren().size() == 1);
+    Vector<GameObject*> children = clone->getChildren();
+    REQUIRE(children.size() == 1);
+    REQUIRE(children[0] != child);
+    REQUIRE(children[0]->transform()->parent() == clone);
+    REQUIRE(children[0]->getChildren().size() == 1);
+    REQUIRE(scene.gameObjectCount() == initialCount + 3);
+  }
+
+  SECTION("many clones are placed by their matrices") {
+    Vector<Mat4<real>> transforms;
+    for (int i = 0; i < 100; i++) {
+      transforms.push_back(Mat4<real>::translate(Vec3{static_cast<real>(i), 2, 0}));
+    }
+    Vector<GameObject*> clones = scene.instantiateMany(prefab, transforms.size(), transforms.data());
+    REQUIRE(clones.size() == 100);
+    REQUIRE(scene.gameObjectCount() == initialCount + 300);
+    REQUIRE(clones[42]->transform()->localPosition() == Vec3{42, 2, 0});
+    REQUIRE(clones[42]->getChildren().size() == 1);
+
+    Vector<GameObject*> unplaced = scene.instantiateMany(prefab, 2);
+    REQUIRE(unplaced[1]->transform()->localPosition() == Vec3{1, 0, 0});
+  }
+
+  SECTION("cloned components live in their pool") {
+    Vector<GameObject*> clones = scene.instantiateMany(prefab, 10);
+    REQUIRE(clones.size() == 10);
+    Handle<Transform> handle = clones[3]->getComponentHandle<Transform>();
+    REQUIRE_FALSE(handle.isNull());
+    REQUIRE(HandlePool<Transform>::getInstance().resolve(handle) == clones[3]->transform());
+    REQUIRE_FALSE(clones[3]->getChildren()[0]->getComponentHandle<Transform>().isNull());
+  }
+
+  SECTION("references into the prefab point at the clone") {
+    SkinnedMeshRenderer* renderer = prefab->addComponent<SkinnedMeshRenderer>();
+    renderer->setRootBone(child);
+    GameObject* clone = scene.instantiate(prefab);
+    SkinnedMeshRenderer* cloned = clone->getComponent<SkinnedMeshRenderer>();
+    REQUIRE(cloned != nullptr);
+    REQUIRE(cloned->getRootBone() == clone->getChildren()[0]);
+
+    GameObject* other = scene.createGameObject("other");
+    renderer->setRootBone(other);
+    REQUIRE(scene.instantiate(prefab)->getComponent<SkinnedMeshRenderer>()->getRootBone() == other);
+  }
+
+  SECTION("objects of another scene are rejected") {
+    Scene another;
+    REQUIRE(another.instantiateMany(prefab, 10).empty());
+  }
+}
@@ -0,0 +1,92 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/SceneManager.h"
+
+using namespace GLaDOS;
+
+class StreamedScene : public Scene {
+public:
+  static constexpr int stepCount = 8;
+
+  bool onLoad() override {
+    mLoaderThread = std::this_thread::get_id();
+    for (int i = 0; i < stepCount; i++) {
+      addActivationStep([this]() { createGameObject("streamed"); });
+    }
+    reportLoadProgress(1);
+    return true;
+  }
+
+  bool onInit() override {
+    mInitThread = std::this_thread::get_id();
+    return true;
+  }
+
+  std::thread::id mLoaderThread;
+  std::thread::id mInitThread;
+};
+
+class BrokenScene : public Scene {
+public:
+  bool onLoad() override { return false; }
+};
+
+template <typename Function>
+static int runFrames(SceneManager& manager, Function&& isDone) {
+  int frame = 0;
+  for (; frame < 1000 && !isDone(); frame++) {
+    manager.update(0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return frame;
+}
+
+TEST_CASE("Scene load unit tests", "[SceneLoad]") {
+  SceneManager& manager = SceneManager::getInstance();
+  real budget = manager.activationBudget();
+
+  SECTION("activation runs on the main thread a step per frame") {
+    manager.setActivationBudget(0);
+    RefPtr<SceneLoadOperation> operation = manager.loadSceneAsync<StreamedScene>("streamed");
+    REQUIRE(operation.isPresent());
+    REQUIRE_FALSE(manager.loadSceneAsync<StreamedScene>("streamed").isPresent());
+    operation->setActivateOnLoad(false);
+
+    real lastProgress = 0;
+    int activatingFrames = 0;
+    runFrames(manager, [&]() {
+      REQUIRE(operation->progress() >= lastProgress);
+      lastProgress = operation->progress();
+      activatingFrames += operation->state() == SceneLoadState::Activating ? 1 : 0;
+      return operation->isDone();
+    });
+    REQUIRE(operation->state() == SceneLoadState::Done);
+    REQUIRE(operation->progress() == 1);
+    REQUIRE(activatingFrames >= StreamedScene::stepCount);
+
+    auto* scene = static_cast<StreamedScene*>(operation->scene());
+    REQUIRE(manager.sceneByName("streamed") == scene);
+    REQUIRE(scene->gameObjectCount() == StreamedScene::stepCount + 1);  // with the main camera
+    REQUIRE(scene->mLoaderThread != std::this_thread::get_id());
+    REQUIRE(scene->mInitThread == std::this_thread::get_id());
+    REQUIRE(manager.activeScene() != scene);
+    REQUIRE(manager.loadingSceneCount() == 0);
+  }
+
+  SECTION("a scene which fails to load is released") {
+    RefPtr<SceneLoadOperation> operation = manager.loadSceneAsync<BrokenScene>("broken");
+    runFrames(manager, [&]() { return operation->isDone(); });
+    REQUIRE(operation->state() == SceneLoadState::Failed);
+    REQUIRE(operation->scene() == nullptr);
+    REQUIRE(manager.sceneByName("broken") == nullptr);
+    REQUIRE(manager.loadingSceneCount() == 0);
+
+    REQUIRE(manager.createScene<BrokenScene>("broken") == nullptr);
+    REQUIRE(manager.sceneByName("broken") == nullptr);
+  }
+
+  manager.setActivationBudget(budget);
+}
@@ -0,0 +1,78 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/component/Camera.h"
+#include "core/component/Transform.h"
+
+using namespace GLaDOS;
+
+class Beacon : public Component {
+public:
+  Beacon() : Component("Beacon") {}
+
+protected:
+  Component* clone() override { return newComponent<Beacon>(); }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+  void update([[maybe_unused]] real deltaTime) override {}
+  void render() override {}
+};
+
+TEST_CASE("SceneRegistry unit tests", "[SceneRegistry]") {
+  Scene scene;
+  GameObject* first = scene.createGameObject("first");
+  GameObject* second = scene.createGameObject("second", first);
+  GameObject* third = scene.createGameObject("third", second);
+  Beacon* firstBeacon = first->addComponent<Beacon>();
+  Beacon* thirdBeacon = third->addComponent<Beacon>();
+
+  SECTION("finds components by type") {
+    FrameVector<Beacon*> beacons = scene.findObjectsOfType<Beacon>();
+    REQUIRE(beacons.size() == 2);
+    REQUIRE(std::find(beacons.begin(), beacons.end(), firstBeacon) != beacons.end());
+    REQUIRE(std::find(beacons.begin(), beacons.end(), thirdBeacon) != beacons.end());
+    REQUIRE(scene.findObjectsOfType<Camera>().size() == 1);
+    REQUIRE(scene.findObjectsOfType<Transform>().size() == scene.gameObjectCount());
+
+    REQUIRE(first->removeComponent<Beacon>());
+    REQUIRE(scene.findObjectsOfType<Beacon>().size() == 1);
+    REQUIRE(scene.findObjectsOfType<Beacon>()[0] == thirdBeacon);
+
+    REQUIRE(scene.destroyImmediate(second));
+    REQUIRE(scene.findObjectsOfType<Beacon>().empty());
+  }
+
+  SECTION("clones are registered") {
+    GameObject* clone = scene.instantiate(first);
+    REQUIRE(clone != nullptr);
+    std::size_t count = 0;
+    scene.forEachObjectOfType<Beacon>([&](Beacon* beacon) {
+      REQUIRE(beacon->gameObject()->scene() == &scene);
+      count++;
+    });
+    REQUIRE(count == 4);
+  }
+
+  SECTION("iterates objects of a layer") {
+    second->setLayer(5);
+    third->setLayer(5);
+    Vector<GameObject*> layer;
+    scene.forEachInLayer(5, [&](GameObject* gameObject) { layer.push_back(gameObject); });
+    REQUIRE(layer.size() == 2);
+
+    third->setLayer(6);
+    layer.clear();
+    scene.forEachInLayer(5, [&](GameObject* gameObject) { layer.push_back(gameObject); });
+    REQUIRE(layer == Vector<GameObject*>{second});
+    std::size_t defaultLayer = 0;
+    scene.forEachInLayer(0, [&](GameObject*) { defaultLayer++; });
+    REQUIRE(defaultLayer == scene.gameObjectCount() - 2);
+  }
+
+  SECTION("getComponentInChildren searches every descendant") {
+    REQUIRE(first->getComponentInChildren<Beacon>() == thirdBeacon);
+    REQUIRE(third->getComponentInChildren<Beacon>() == nullptr);
+  }
+}
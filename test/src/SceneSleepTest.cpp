@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/GameObject.hpp"
+#include "core/MessageBus.hpp"
+#include "core/Scene.h"
+#include "core/component/Camera.h"
+#include "core/component/Transform.h"
+
+using namespace GLaDOS;
+
+class SleepScene : public Scene {
+public:
+  using Scene::fixedUpdate;
+  using Scene::update;
+};
+
+class Sleeper : public Component {
+public:
+  Sleeper() : Component("Sleeper") {}
+
+  int mCount{0};
+  int mFixedCount{0};
+  int mMessages{0};
+  bool mSleepInUpdate{false};
+
+protected:
+  MessageResult handleMessage([[maybe_unused]] Message& msg) override {
+    mMessages++;
+    return MessageResult::True;
+  }
+  Component* clone() override { return nullptr; }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override { mFixedCount++; }
+  void update([[maybe_unused]] real deltaTime) override {
+    mCount++;
+    if (mSleepInUpdate) {
+      sleep();
+    }
+  }
+  void render() override {}
+};
+
+TEST_CASE("Scene sleep unit tests", "[SceneSleep]") {
+  SleepScene scene;
+  scene.getMainCamera()->gameObject()->active(false);
+  GameObject* gameObject = scene.createGameObject("sleeper");
+  Sleeper* sleeper = gameObject->addComponent<Sleeper>();
+
+  SECTION("objects with only idle components are not visited") {
+    GameObject* idle = scene.createGameObject("idle");
+    scene.update(0.1f);
+    REQUIRE(idle->transform()->isSleeping());
+    REQUIRE(scene.awakeObjectCount() == 2);  // the camera and the sleeper
+
+    sleeper->sleep();
+    scene.update(0.1f);
+    scene.fixedUpdate(0.02f);
+    REQUIRE(sleeper->mCount == 1);
+    REQUIRE(sleeper->mFixedCount == 0);
+    REQUIRE(scene.awakeObjectCount() == 1);
+
+    sleeper->wake();
+    scene.update(0.1f);
+    REQUIRE(sleeper->mCount == 2);
+    REQUIRE(scene.awakeObjectCount() == 2);
+  }
+
+  SECTION("a component put to sleep in its update is skipped from the next frame") {
+    sleeper->mSleepInUpdate = true;
+    scene.update(0.1f);
+    scene.update(0.1f);
+    REQUIRE(sleeper->mCount == 1);
+    REQUIRE(sleeper->isSleeping());
+  }
+
+  SECTION("timer wakes after the given scene time") {
+    sleeper->sleepFor(0.25f);
+    scene.update(0.1f);
+    scene.update(0.1f);
+    REQUIRE(sleeper->mCount == 0);
+    scene.update(0.1f);
+    REQUIRE(sleeper->mCount == 1);
+
+    // a timer of an earlier sleep doesn't end a later one
+    sleeper->sleepFor(0.15f);
+    sleeper->wake();
+    sleeper->sleep();
+    scene.update(0.1f);
+    scene.update(0.1f);
+    REQUIRE(sleeper->isSleeping());
+    REQUIRE(sleeper->mCount == 1);
+  }
+
+  SECTION("messages wake components that asked for it") {
+    gameObject->subscribeToMessageType<Sleeper>(MessageType::OnCollisionEnter);
+    sleeper->sleep();
+    scene.messageBus()->post(gameObject, MessageType::OnCollisionEnter);
+    scene.update(0.1f);
+    REQUIRE(sleeper->mMessages == 1);
+    REQUIRE(sleeper->mCount == 0);
+
+    sleeper->setWakeOnMessage(true);
+    scene.messageBus()->post(gameObject, MessageType::OnCollisionEnter);
+    scene.update(0.1f);
+    REQUIRE(sleeper->mMessages == 2);
+    REQUIRE(sleeper->mCount == 1);
+  }
+
+  SECTION("transform changes of the object or a parent wake components that asked for it") {
+    GameObject* parent = scene.createGameObject("parent");
+    gameObject->transform()->setParent(parent);
+    scene.update(0.1f);
+    sleeper->setWakeOnTransformChange(true);
+    sleeper->sleep();
+    scene.update(0.1f);
+    REQUIRE(sleeper->mCount == 1);
+
+    parent->transform()->setLocalPosition(Vec3{1, 0, 0});
+    scene.update(0.1f);
+    REQUIRE(sleeper->mCount == 2);
+  }
+
+  SECTION("destroying a sleeping object drops its timers") {
+    sleeper->sleepFor(0.1f);
+    REQUIRE(scene.destroyImmediate(gameObject));
+    scene.update(0.2f);
+    REQUIRE(scene.awakeObjectCount() == 1);
+  }
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdio>
+
+#include "core/Scene.h"
+#include "core/TransformHierarchy.h"
+#include "core/component/Camera.h"
+#include "core/component/Transform.h"
+#include "core/loader/SceneSnapshot.h"
+
+using namespace GLaDOS;
+
+class MeshTag : public Component {
+public:
+  MeshTag() : Component("MeshTag") {}
+
+  Resource* mMesh{nullptr};
+  int32_t mSubMesh{0};
+
+protected:
+  Component* clone() override { return nullptr; }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+  void update([[maybe_unused]] real deltaTime) override {}
+  void render() override {}
+};
+
+struct MeshTagRecord {
+  SnapshotString mesh;
+  int32_t subMesh;
+};
+
+TEST_CASE("SceneSnapshot unit tests", "[SceneSnapshot]") {
+  static Resource* mesh = [] {
+    auto* resource = NEW_T(Resource)(ResourceType::Mesh);
+    resource->setName("snapshot_test_mesh");
+    ResourceManager::getInstance().store(resource);
+    return resource;
+  }();
+  SceneSnapshot::registerCodec<MeshTag, MeshTagRecord>(
+      "MeshTag",
+      [](MeshTag& tag, MeshTagRecord& record, SnapshotStringTable& strings) {
+        record.mesh = strings.add(tag.mMesh->name());
+        record.subMesh = tag.mSubMesh;
+      },
+      [](GameObject* gameObject, const MeshTagRecord& record, const SceneSnapshot& snapshot) {
+        MeshTag* tag = gameObject->addComponent<MeshTag>();
+        tag->mMesh = snapshot.resource<Resource>(record.mesh, ResourceType::Mesh);
+        tag->mSubMesh = record.subMesh;
+        return tag->mMesh != nullptr;
+      });
+
+  Scene source;
+  source.getMainCamera()->setFieldOfView(Deg{45});
+  GameObject* root = source.createGameObject("root");
+  root->transform()->setLocalPosition(Vec3{1, 2, 3});
+  GameObject* child = source.createGameObject("child", root);
+  child->transform()->setLocalScale(Vec3{2, 2, 2});
+  child->active(false);
+  MeshTag* tag = child->addComponent<MeshTag>();
+  tag->mMesh = mesh;
+  tag->mSubMesh = 7;
+  source.destroy(source.createGameObject("pending"));
+
+  Blob blob;
+  REQUIRE(SceneSnapshot::save(&source, blob));
+
+  SECTION("instantiates hierarchy, transforms and components") {
+    SceneSnapshot snapshot;
+    REQUIRE(snapshot.open(std::move(blob)));
+    REQUIRE(snapshot.objectCount() == 3);  // camera, root, child
+
+    Scene target;
+    std::size_t initialCount = target.gameObjectCount();
+    REQUIRE(snapshot.instantiate(&target));
+    REQUIRE(target.gameObjectCount() == initialCount + 2);  // the camera maps onto the main camera
+    REQUIRE(target.getMainCamera()->fieldOfView().get() == 45);
+
+    Transform* copiedRoot = nullptr;
+    for (std::size_t i = 0; i < target.transformHierarchy()->size(); i++) {
+      Transform* transform = target.transformHierarchy()->transformAt(i);
+      if (transform != nullptr && transform->gameObject()->getName() == "root") {
+        copiedRoot = transform;
+      }
+    }
+    REQUIRE(copiedRoot != nullptr);
+    REQUIRE(copiedRoot->localPosition() == Vec3{1, 2, 3});
+    Vector<GameObject*> children = copiedRoot->gameObject()->getChildren();
+    REQUIRE(children.size() == 1);
+    GameObject* copiedChild = children[0];
+    REQUIRE(copiedChild->getName() == "child");
+    REQUIRE_FALSE(copiedChild->isActive());
+    REQUIRE(copiedChild->transform()->localScale() == Vec3{2, 2, 2});
+    MeshTag* copiedTag = copiedChild->getComponent<MeshTag>();
+    REQUIRE(copiedTag != nullptr);
+    REQUIRE(copiedTag->mMesh == mesh);
+    REQUIRE(copiedTag->mSubMesh == 7);
+  }
+
+  SECTION("maps a snapshot file") {
+    const char* path = "scene_snapshot_test.bin";
+    REQUIRE(SceneSnapshot::save(&source, path));
+    SceneSnapshot snapshot;
+    REQUIRE(snapshot.open(path));
+    Scene target;
+    REQUIRE(snapshot.instantiate(&target));
+    REQUIRE(snapshot.objectCount() == 3);
+    std::remove(path);
+  }
+
+  SECTION("rejects a foreign or newer file") {
+    Blob newer{blob};
+    reinterpret_cast<SnapshotHeader*>(newer.pointer())->version = SceneSnapshot::version + 1;
+    SceneSnapshot snapshot;
+    REQUIRE_FALSE(snapshot.open(std::move(newer)));
+    REQUIRE_FALSE(snapshot.instantiate(&source));
+
+    Blob truncated{blob.view().data(), sizeof(SnapshotHeader)};
+    REQUIRE_FALSE(snapshot.open(std::move(truncated)));
+
+    // written on a host of the other byte order
+    Blob swapped{blob};
+    std::reverse(swapped.pointer(), swapped.pointer() + sizeof(uint32_t));
+    REQUIRE_FALSE(snapshot.open(std::move(swapped)));
+  }
+}
@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/component/Camera.h"
+#include "core/component/Transform.h"
+#include "utils/FixedThreadPool.hpp"
+
+using namespace GLaDOS;
+
+class UpdateScene : public Scene {
+public:
+  using Scene::fixedUpdate;
+  using Scene::update;
+};
+
+class ParallelCounter : public Component {
+public:
+  ParallelCounter() : Component("ParallelCounter") {}
+  bool isThreadSafe() const override { return true; }
+
+  int mCount{0};
+  int mFixedCount{0};
+
+protected:
+  Component* clone() override { return nullptr; }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override { mFixedCount++; }
+  void update([[maybe_unused]] real deltaTime) override { mCount++; }
+  void render() override {}
+};
+
+class ParallelMover : public Component {
+public:
+  ParallelMover() : Component("ParallelMover") {}
+  bool isThreadSafe() const override { return true; }
+
+protected:
+  Component* clone() override { return nullptr; }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+  void update([[maybe_unused]] real deltaTime) override { gameObject()->transform()->setLocalPosition(Vec3{1, 0, 0}); }
+  void render() override {}
+};
+
+static Vector<std::string> updateOrder;
+
+class MainThreadRecorder : public Component {
+public:
+  MainThreadRecorder() : Component("MainThreadRecorder") {}
+
+  std::thread::id mThreadId;
+
+protected:
+  Component* clone() override { return nullptr; }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+  void update([[maybe_unused]] real deltaTime) override {
+    mThreadId = std::this_thread::get_id();
+    updateOrder.push_back("gameplay");
+  }
+  void render() override {}
+};
+
+class RendererPrepRecorder : public Component {
+public:
+  RendererPrepRecorder() : Component("RendererPrepRecorder") {}
+  UpdatePhase updatePhase() const override { return UpdatePhase::RendererPrep; }
+
+protected:
+  Component* clone() override { return nullptr; }
+  void fixedUpdate([[maybe_unused]] real fixedDeltaTime) override {}
+  void update([[maybe_unused]] real deltaTime) override { updateOrder.push_back("rendererPrep"); }
+  void render() override {}
+};
+
+TEST_CASE("Scene update unit tests", "[SceneUpdate]") {
+  FixedThreadPool pool{3};
+  UpdateScene scene;
+  scene.getMainCamera()->gameObject()->active(false);
+  scene.setUpdateThreadPool(&pool, 16);
+  updateOrder.clear();
+
+  SECTION("thread safe components of every object run once") {
+    Vector<ParallelCounter*> counters;
+    for (int i = 0; i < 500; i++) {
+      counters.push_back(scene.createGameObject("object")->addComponent<ParallelCounter>());
+    }
+    counters.back()->gameObject()->active(false);
+    scene.update(0.1f);
+    scene.fixedUpdate(0.02f);
+    for (std::size_t i = 0; i + 1 < counters.size(); i++) {
+      REQUIRE(counters[i]->mCount == 1);
+      REQUIRE(counters[i]->mFixedCount == 1);
+    }
+    REQUIRE(counters.back()->mCount == 0);
+  }
+
+  SECTION("transform changes of thread safe components reach children after the phase") {
+    GameObject* parent = scene.createGameObject("mover");
+    parent->addComponent<ParallelMover>();
+    GameObject* child = scene.createGameObject("child", parent);
+    child->transform()->setLocalPosition(Vec3{0, 2, 0});
+    ParallelCounter* sleeper = child->addComponent<ParallelCounter>();
+    sleeper->setWakeOnTransformChange(true);
+    sleeper->sleep();
+    scene.update(0.1f);
+    REQUIRE_FALSE(sleeper->isSleeping());
+    REQUIRE(child->transform()->localToWorldMatrix() == Mat4<real>::translate(Vec3{1, 2, 0}));
+  }
+
+  SECTION("other components run on the main thread in phase order") {
+    GameObject* gameObject = scene.createGameObject("recorder");
+    gameObject->addComponent<RendererPrepRecorder>();
+    MainThreadRecorder* recorder = gameObject->addComponent<MainThreadRecorder>();
+    scene.update(0.1f);
+    REQUIRE(recorder->mThreadId == std::this_thread::get_id());
+    REQUIRE(updateOrder == Vector<std::string>{"gameplay", "rendererPrep"});
+  }
+}
@@ -0,0 +1,66 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "memory/SizeClassAllocator.h"
+#include "utils/Stl.h"
+
+using namespace GLaDOS;
+
+TEST_CASE("SizeClassAllocator unit tests", "[SizeClassAllocator]") {
+  SECTION("size class mapping") {
+    REQUIRE(SizeClassAllocator::sizeClassOf(1) == 0);
+    REQUIRE(SizeClassAllocator::sizeClassOf(16) == 0);
+    REQUIRE(SizeClassAllocator::sizeClassOf(17) == 1);
+    REQUIRE(SizeClassAllocator::sizeClassOf(256) == SizeClassAllocator::classCount - 1);
+    REQUIRE(SizeClassAllocator::isSmall(256, 8));
+    REQUIRE_FALSE(SizeClassAllocator::isSmall(257, 8));
+    REQUIRE_FALSE(SizeClassAllocator::isSmall(32, 64));
+    REQUIRE_FALSE(SizeClassAllocator::isSmall(0, 1));
+  }
+
+  SECTION("blocks are aligned and reused") {
+    void* p1 = SizeClassAllocator::allocate(24);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p1) % SizeClassAllocator::granularity == 0);
+    std::memset(p1, 0xAB, 24);
+    SizeClassAllocator::deallocate(p1, 24);
+    void* p2 = SizeClassAllocator::allocate(32);
+    REQUIRE(p1 == p2);
+    SizeClassAllocator::deallocate(p2, 32);
+  }
+
+  SECTION("blocks freed on other threads return to the free lists") {
+    constexpr int count = 4096;
+    std::vector<void*> blocks(count);
+    for (auto& block : blocks) {
+      block = SizeClassAllocator::allocate(48);
+    }
+    std::thread consumer([&blocks] {
+      for (auto& block : blocks) {
+        SizeClassAllocator::deallocate(block, 48);
+      }
+    });
+    consumer.join();
+
+    std::size_t slabCount = SizeClassAllocator::slabCount();
+    for (auto& block : blocks) {
+      block = SizeClassAllocator::allocate(48);
+    }
+    REQUIRE(SizeClassAllocator::slabCount() == slabCount);
+    for (auto& block : blocks) {
+      SizeClassAllocator::deallocate(block, 48);
+    }
+  }
+
+  SECTION("node based containers") {
+    Set<int> set;
+    Map<int, std::string> map;
+    for (int i = 0; i < 1000; i++) {
+      set.insert(i);
+      map.emplace(i, std::to_string(i));
+    }
+    REQUIRE(set.size() == 1000);
+    REQUIRE(map[999] == "999");
+  }
+}
@@ -0,0 +1,135 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <random>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/component/Transform.h"
+#include "core/spatial/LooseOctree.h"
+#include "core/spatial/SpatialHash.h"
+
+using namespace GLaDOS;
+
+static Vec3 randomPosition(std::mt19937& random, real extent) {
+  std::uniform_real_distribution<real> distribution{-extent, extent};
+  return Vec3{distribution(random), distribution(random), distribution(random)};
+}
+
+// checks every query of `index` against a linear scan over `positions`
+static void checkQueries(const SpatialIndex& index, const Vector<GameObject*>& objects, const Vector<Vec3>& positions, std::mt19937& random) {
+  Vector<GameObject*> result(objects.size());
+  Vector<real> distances(objects.size());
+  for (int query = 0; query < 20; query++) {
+    Vec3 center = randomPosition(random, 60);
+
+    Vector<GameObject*> expected;
+    for (std::size_t i = 0; i < objects.size(); i++) {
+      if (positions[i].distance(center) <= 15) {
+        expected.push_back(objects[i]);
+      }
+    }
+    std::size_t count = index.queryRadius(center, 15, result.data(), result.size());
+    Vector<GameObject*> found{result.begin(), result.begin() + count};
+    std::sort(expected.begin(), expected.end());
+    std::sort(found.begin(), found.end());
+    REQUIRE(found == expected);
+
+    Vec3 min = center - 10;
+    Vec3 max = center + Vec3{20, 5, 10};
+    expected.clear();
+    for (std::size_t i = 0; i < objects.size(); i++) {
+      const Vec3& p = positions[i];
+      if (p.x >= min.x && p.y >= min.y && p.z >= min.z && p.x <= max.x && p.y <= max.y && p.z <= max.z) {
+        expected.push_back(objects[i]);
+      }
+    }
+    count = index.queryAABB(min, max, result.data(), result.size());
+    found.assign(result.begin(), result.begin() + count);
+    std::sort(expected.begin(), expected.end());
+    std::sort(found.begin(), found.end());
+    REQUIRE(found == expected);
+
+    Vector<real> sorted;
+    for (const Vec3& position : positions) {
+      sorted.push_back(position.distance(center));
+    }
+    std::sort(sorted.begin(), sorted.end());
+    count = index.queryNearest(center, 5, result.data(), distances.data());
+    REQUIRE(count == 5);
+    for (std::size_t i = 0; i < count; i++) {
+      REQUIRE(distances[i] == sorted[i]);
+    }
+  }
+}
+
+TEST_CASE("SpatialIndex unit tests", "[SpatialIndex]") {
+  std::mt19937 random{7};
+  Scene scene;
+  Vector<GameObject*> objects;
+  Vector<Vec3> positions;
+  for (int i = 0; i < 500; i++) {
+    objects.push_back(scene.createGameObject("object"));
+    // a dense cluster and sparse outliers, some outside of the octree
+    positions.push_back(i % 5 == 0 ? randomPosition(random, 150) : randomPosition(random, 20));
+  }
+
+  SECTION("spatial hash and loose octree agree with a linear scan") {
+    SpatialHash hash{8};
+    LooseOctree octree{Vec3{0, 0, 0}, 100, 6, 8};
+    for (SpatialIndex* index : {static_cast<SpatialIndex*>(&hash), static_cast<SpatialIndex*>(&octree)}) {
+      for (std::size_t i = 0; i < objects.size(); i++) {
+        index->update(objects[i], positions[i]);
+      }
+      REQUIRE(index->size() == objects.size());
+      checkQueries(*index, objects, positions, random);
+
+      // small moves, jumps, and removes
+      Vector<GameObject*> kept;
+      Vector<Vec3> keptPositions;
+      for (std::size_t i = 0; i < objects.size(); i++) {
+        if (i % 7 == 0) {
+          index->remove(objects[i]);
+          continue;
+        }
+        Vec3 position = i % 3 == 0 ? randomPosition(random, 120) : positions[i] + randomPosition(random, 2);
+        index->update(objects[i], position);
+        kept.push_back(objects[i]);
+        keptPositions.push_back(position);
+      }
+      REQUIRE(index->size() == kept.size());
+      REQUIRE_FALSE(index->contains(objects[0]));
+      checkQueries(*index, kept, keptPositions, random);
+    }
+    REQUIRE(octree.nodeCount() > 1);
+  }
+
+  SECTION("scene keeps the index in sync with transforms") {
+    for (std::size_t i = 0; i < objects.size(); i++) {
+      objects[i]->transform()->setLocalPosition(positions[i]);
+    }
+    GameObject* child = scene.createGameObject("child", objects[1]);
+    child->transform()->setLocalPosition(Vec3{1, 0, 0});
+    scene.setSpatialIndex(NEW_T(SpatialHash)(8));
+
+    GameObject* result[4];
+    real distances[4];
+    REQUIRE(scene.queryNearest(positions[1] + Vec3{1, 0, 0}, 1, result, distances) == 1);
+    REQUIRE(result[0] == child);
+
+    // moving the parent moves the child in the index too
+    objects[1]->transform()->setLocalPosition(Vec3{500, 500, 500});
+    REQUIRE(scene.queryRadius(Vec3{501, 500, 500}, 0.5, result, 4) == 1);
+    REQUIRE(result[0] == child);
+
+    REQUIRE(scene.destroyImmediate(child));
+    REQUIRE(scene.queryRadius(Vec3{501, 500, 500}, 0.5, result, 4) == 0);
+    REQUIRE(scene.queryAABB(Vec3{499, 499, 499}, Vec3{501, 501, 501}, result, 4) == 1);
+    REQUIRE(result[0] == objects[1]);
+
+    scene.setSpatialIndex(NEW_T(LooseOctree)(Vec3{0, 0, 0}, 100));
+    REQUIRE(scene.spatialIndex()->size() == 0);
+    REQUIRE(scene.queryAABB(Vec3{499, 499, 499}, Vec3{501, 501, 501}, result, 4) == 1);
+    REQUIRE(scene.spatialIndex()->size() == scene.gameObjectCount());
+  }
+}
@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Scene.h"
+#include "core/SceneManager.h"
+#include "platform/Timer.h"
+
+using namespace GLaDOS;
+
+class FixedStepScene : public Scene {
+public:
+  void onFixedUpdate(real fixedDeltaTime) override {
+    mSteps++;
+    mSimulatedTime += fixedDeltaTime;
+  }
+
+  int mSteps{0};
+  real mSimulatedTime{0};
+};
+
+TEST_CASE("Timer unit tests", "[Timer]") {
+  SceneManager& manager = SceneManager::getInstance();
+  static auto* scene = static_cast<FixedStepScene*>(manager.createScene<FixedStepScene>("fixed_step"));
+  REQUIRE(scene != nullptr);
+  Scene* previous = manager.activeScene();
+  REQUIRE(manager.setActiveScene(scene));
+  scene->mSteps = 0;
+  scene->mSimulatedTime = 0;
+
+  Timer& timer = Timer::getInstance();
+  real fixedDeltaTime = timer.fixedDeltaTime();
+  int maxSteps = timer.maxFixedStepsPerFrame();
+  timer.setFixedDeltaTime(0.125);
+  timer.reset();
+
+  SECTION("a slow frame catches up with several steps") {
+    timer.update(0.375);
+    REQUIRE(timer.fixedStepsThisFrame() == 3);
+    REQUIRE(scene->mSteps == 3);
+    REQUIRE(timer.fixedStepAlpha() == 0);
+
+    timer.update(0.0625);
+    REQUIRE(timer.fixedStepsThisFrame() == 0);
+    REQUIRE(timer.fixedStepAlpha() == 0.5);
+  }
+
+  SECTION("steps beyond the cap are dropped") {
+    timer.setMaxFixedStepsPerFrame(2);
+    real dropped = timer.droppedFixedTime();
+    timer.update(1.0625);
+    REQUIRE(scene->mSteps == 2);
+    REQUIRE(timer.droppedFixedTime() - dropped == 0.75);
+    REQUIRE(timer.fixedStepAlpha() == 0.5);
+  }
+
+  SECTION("sub steps split a fixed step") {
+    timer.setFixedSubSteps(4);
+    timer.update(0.25);
+    REQUIRE(timer.fixedStepsThisFrame() == 2);
+    REQUIRE(scene->mSteps == 8);
+    REQUIRE(scene->mSimulatedTime == 0.25);
+    timer.setFixedSubSteps(1);
+  }
+
+  timer.setMaxFixedStepsPerFrame(maxSteps);
+  timer.setFixedDeltaTime(fixedDeltaTime);
+  if (previous != nullptr) {
+    manager.setActiveScene(previous);
+  }
+}
@@ -0,0 +1,73 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/GameObject.hpp"
+#include "core/Scene.h"
+#include "core/TransformHierarchy.h"
+#include "core/component/Camera.h"
+#include "core/component/Transform.h"
+
+using namespace GLaDOS;
+
+class HierarchyScene : public Scene {
+public:
+  using Scene::update;
+};
+
+static Vec3 translationOf(const Mat4<real>& matrix) {
+  return Vec3{matrix._m44[3][0], matrix._m44[3][1], matrix._m44[3][2]};
+}
+
+TEST_CASE("TransformHierarchy unit tests", "[TransformHierarchy]") {
+  HierarchyScene scene;
+  scene.getMainCamera()->gameObject()->active(false);
+  TransformHierarchy* hierarchy = scene.transformHierarchy();
+  GameObject* parent = scene.createGameObject("parent");
+  GameObject* child = scene.createGameObject("child", parent);
+  GameObject* grandChild = scene.createGameObject("grandChild", child);
+  parent->transform()->setLocalPosition(Vec3{1, 0, 0});
+  child->transform()->setLocalPosition(Vec3{0, 2, 0});
+  grandChild->transform()->setLocalPosition(Vec3{0, 0, 3});
+
+  SECTION("parents precede their children") {
+    REQUIRE(hierarchy->size() == 4);
+    for (std::size_t i = 0; i < hierarchy->size(); i++) {
+      REQUIRE(hierarchy->parentAt(i) < static_cast<int32_t>(i));
+    }
+  }
+
+  SECTION("update computes world matrices in one pass") {
+    scene.update(0.f);
+    REQUIRE(translationOf(hierarchy->worldMatrices()[3]) == Vec3{1, 2, 3});
+    REQUIRE(translationOf(grandChild->transform()->localToWorldMatrix()) == Vec3{1, 2, 3});
+  }
+
+  SECTION("moving a parent invalidates its descendants") {
+    REQUIRE(translationOf(grandChild->transform()->localToWorldMatrix()) == Vec3{1, 2, 3});
+    parent->transform()->setLocalPosition(Vec3{5, 0, 0});
+    REQUIRE(translationOf(grandChild->transform()->localToWorldMatrix()) == Vec3{5, 2, 3});
+    child->transform()->setLocalPosition(Vec3{0, 4, 0});
+    scene.update(0.f);
+    REQUIRE(translationOf(grandChild->transform()->localToWorldMatrix()) == Vec3{5, 4, 3});
+  }
+
+  SECTION("reparenting to a later object keeps the order") {
+    GameObject* other = scene.createGameObject("other");
+    other->transform()->setLocalPosition(Vec3{0, 0, 10});
+    parent->transform()->setParent(other);
+    scene.update(0.f);
+    for (std::size_t i = 0; i < hierarchy->size(); i++) {
+      REQUIRE(hierarchy->parentAt(i) < static_cast<int32_t>(i));
+    }
+    REQUIRE(translationOf(grandChild->transform()->localToWorldMatrix()) == Vec3{1, 2, 13});
+  }
+
+  SECTION("destroyed objects leave the hierarchy") {
+    REQUIRE(scene.destroyImmediate(child));
+    scene.update(0.f);
+    std::size_t alive = 0;
+    for (std::size_t i = 0; i < hierarchy->size(); i++) {
+      alive += hierarchy->transformAt(i) != nullptr ? 1 : 0;
+    }
+    REQUIRE(alive == 2);
+  }
+}